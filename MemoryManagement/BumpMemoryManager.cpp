@@ -1,18 +1,97 @@
 #include "BumpMemoryManager.h"
+#include <new>
+#include <stdexcept>
+
+namespace {
+    // A Pooled Session's Resources Live at the Front of its Own Arena
+    template<typename Pool>
+    struct ArenaResources {
+        std::pmr::monotonic_buffer_resource monotonic;
+        Pool pool;
+
+        ArenaResources(std::byte* buffer, size_t size)
+            : monotonic(buffer, size),
+            pool(&monotonic)
+        {
+
+        }
+    };
+
+    constexpr size_t ArenaHeaderSize = 4096;
+    static_assert(sizeof(ArenaResources<std::pmr::synchronized_pool_resource>) <= ArenaHeaderSize);
+    static_assert(sizeof(ArenaResources<std::pmr::unsynchronized_pool_resource>) <= ArenaHeaderSize);
+
+    template<typename Pool>
+    std::unique_ptr<std::pmr::memory_resource, BumpMemoryManager::CustomDeleter> createPooledResource(SessionArenaPool* arenas, std::byte* arena) {
+        auto* resources = new (arena) ArenaResources<Pool>(
+            arena + ArenaHeaderSize,
+            arenas->config().arenaSize - ArenaHeaderSize
+        );
+
+        // Two Pointers Fit std::function's Inline Storage: No Allocation
+        BumpMemoryManager::CustomDeleter deleter = [arenas, resources](std::pmr::memory_resource*) {
+            resources->~ArenaResources();
+            arenas->release(reinterpret_cast<std::byte*>(resources));
+            };
+
+        return std::unique_ptr<std::pmr::memory_resource, BumpMemoryManager::CustomDeleter>(
+            &resources->pool,
+            std::move(deleter)
+        );
+    }
+}
 
 BumpMemoryManager::BumpMemoryManager(size_t bufferSize)
     : buffer_(std::make_unique<std::byte[]>(bufferSize)),
     mbr_(buffer_.get(), bufferSize),
-    pool_(&mbr_)
+    pool_(&mbr_, std::pmr::new_delete_resource())
 {
 
 }
 
+BumpMemoryManager::BumpMemoryManager(size_t bufferSize, const SessionArenaPool::Config& sessionArenas)
+    : BumpMemoryManager(bufferSize)
+{
+    if (sessionArenas.arenaCount == 0) {
+        return;
+    }
+    if (sessionArenas.arenaSize == 0) {
+        throw std::invalid_argument("Session Arena Has No Usable Bytes");
+    }
+
+    // arenaSize is What a Session Gets; the Header Rides on Top of it
+    SessionArenaPool::Config strided = sessionArenas;
+    strided.arenaSize += ArenaHeaderSize;
+    sessionArenas_ = std::make_unique<SessionArenaPool>(strided);
+}
+
 std::pmr::memory_resource* BumpMemoryManager::getResource() {
     return &pool_;
 }
 
+ThreadCachingResource::Stats BumpMemoryManager::getResourceStats() const {
+    return pool_.stats();
+}
+
+const SessionArenaPool* BumpMemoryManager::getSessionArenaPool() const {
+    return sessionArenas_.get();
+}
+
 std::unique_ptr<std::pmr::memory_resource, BumpMemoryManager::CustomDeleter> BumpMemoryManager::createClientResource(size_t clientBufferSize, bool synchronizedPool) {
+    // Recycled Arena When One is Free and Big Enough
+    if (sessionArenas_ && clientBufferSize <= sessionArenas_->config().arenaSize - ArenaHeaderSize) {
+        if (std::byte* arena = sessionArenas_->acquire()) {
+            if (synchronizedPool) {
+                return createPooledResource<std::pmr::synchronized_pool_resource>(sessionArenas_.get(), arena);
+            }
+            return createPooledResource<std::pmr::unsynchronized_pool_resource>(sessionArenas_.get(), arena);
+        }
+
+        if (sessionArenas_->config().overflow == SessionArenaPool::Overflow::Reject) {
+            return nullptr;
+        }
+    }
+
     // Allocate Client Buffer from Main Pool
     std::byte* rawBuffer = new std::byte[clientBufferSize];
 
@@ -1,11 +1,15 @@
 #pragma once
 
-#ifdef MEM_MANAGER_EXPORTS
+#if !defined(_WIN32)
+#define MEM_MANAGER
+#elif defined(MEM_MANAGER_EXPORTS)
 #define MEM_MANAGER __declspec(dllexport)
 #else
 #define MEM_MANAGER __declspec(dllimport)
 #endif
 
+#include "SessionArenaPool.h"
+#include "ThreadCachingResource.h"
 #include <memory>
 #include <memory_resource>
 #include <functional>
@@ -14,7 +18,8 @@ class MEM_MANAGER BumpMemoryManager {
 private:
     std::unique_ptr<std::byte[]> buffer_;
     std::pmr::monotonic_buffer_resource mbr_;
-    std::pmr::synchronized_pool_resource pool_;
+    ThreadCachingResource pool_;       // Slabs From mbr_, Large Blocks From the Heap
+    std::unique_ptr<SessionArenaPool> sessionArenas_;
 
 public:
     using CustomDeleter = std::function<void(std::pmr::memory_resource*)>;
@@ -22,12 +27,22 @@ public:
     // Constructor with Size
     BumpMemoryManager(size_t bufferSize);
 
+    // Constructor with Recycled Session Arenas for createClientResource; Each
+    // Session Gets arenaSize Usable Bytes Past the Arena's Resource Header
+    BumpMemoryManager(size_t bufferSize, const SessionArenaPool::Config& sessionArenas);
+
     // Destructor
     ~BumpMemoryManager() = default;
 
     std::pmr::memory_resource* getResource();
+    ThreadCachingResource::Stats getResourceStats() const;
+
+    // Empty When the Session Arenas are Exhausted and Overflow is Reject
     std::unique_ptr<std::pmr::memory_resource, CustomDeleter> createClientResource(size_t clientBufferSize = 256 * 1024, bool synchronizedPool = false);
 
+    // nullptr Unless Constructed With Session Arenas
+    const SessionArenaPool* getSessionArenaPool() const;
+
     // Delete Copy/Move Operations
     BumpMemoryManager(const BumpMemoryManager&) = delete;
     BumpMemoryManager& operator=(const BumpMemoryManager&) = delete;
@@ -0,0 +1,49 @@
+#include "CountingResource.h"
+
+CountingResource::CountingResource(std::pmr::memory_resource* upstream)
+    : upstream_(upstream),
+    allocations_(0),
+    deallocations_(0),
+    bytesAllocated_(0),
+    bytesOutstanding_(0)
+{
+
+}
+
+CountingResource::Counts CountingResource::counts() const {
+    return Counts{
+        allocations_.load(std::memory_order_relaxed),
+        deallocations_.load(std::memory_order_relaxed),
+        bytesAllocated_.load(std::memory_order_relaxed),
+        bytesOutstanding_.load(std::memory_order_relaxed)
+    };
+}
+
+void CountingResource::reset() {
+    // Outstanding Bytes Still Belong to Live Allocations, so They Carry Over
+    allocations_.store(0, std::memory_order_relaxed);
+    deallocations_.store(0, std::memory_order_relaxed);
+    bytesAllocated_.store(0, std::memory_order_relaxed);
+}
+
+std::pmr::memory_resource* CountingResource::upstream() const {
+    return upstream_;
+}
+
+void* CountingResource::do_allocate(size_t bytes, size_t alignment) {
+    void* ptr = upstream_->allocate(bytes, alignment);
+    allocations_.fetch_add(1, std::memory_order_relaxed);
+    bytesAllocated_.fetch_add(bytes, std::memory_order_relaxed);
+    bytesOutstanding_.fetch_add(bytes, std::memory_order_relaxed);
+    return ptr;
+}
+
+void CountingResource::do_deallocate(void* ptr, size_t bytes, size_t alignment) {
+    upstream_->deallocate(ptr, bytes, alignment);
+    deallocations_.fetch_add(1, std::memory_order_relaxed);
+    bytesOutstanding_.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+bool CountingResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
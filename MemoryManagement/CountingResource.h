@@ -0,0 +1,52 @@
+#pragma once
+
+#if !defined(_WIN32)
+#define MEM_MANAGER
+#elif defined(MEM_MANAGER_EXPORTS)
+#define MEM_MANAGER __declspec(dllexport)
+#else
+#define MEM_MANAGER __declspec(dllimport)
+#endif
+
+#include <memory_resource>
+#include <atomic>
+#include <cstddef>
+
+// Pass-Through Resource That Counts What Reaches its Upstream. Wrap the
+// Resource Handed to a Component to See How Often it Allocates per Operation
+class MEM_MANAGER CountingResource : public std::pmr::memory_resource {
+public:
+    struct Counts {
+        size_t allocations;
+        size_t deallocations;
+        size_t bytesAllocated;
+        size_t bytesOutstanding;    // Allocated and Not Yet Returned
+    };
+
+    explicit CountingResource(std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+    Counts counts() const;
+    void reset();
+
+    std::pmr::memory_resource* upstream() const;
+
+    // Delete Copy/Move Operations
+    CountingResource(const CountingResource&) = delete;
+    CountingResource& operator=(const CountingResource&) = delete;
+    CountingResource(CountingResource&&) = delete;
+    CountingResource& operator=(CountingResource&&) = delete;
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+    std::pmr::memory_resource* upstream_;
+
+    // Relaxed: Totals Only, Never Used to Order Other Memory
+    std::atomic<size_t> allocations_;
+    std::atomic<size_t> deallocations_;
+    std::atomic<size_t> bytesAllocated_;
+    std::atomic<size_t> bytesOutstanding_;
+};
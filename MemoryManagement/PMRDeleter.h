@@ -1,14 +1,28 @@
 #pragma once
 #include <memory_resource>
+#include <memory>
+#include <type_traits>
 
 template<typename T>
 class PMRDeleter {
 private:
     std::pmr::memory_resource* resource_;
+    size_t size_;
+    size_t alignment_;
+
+    template<typename U>
+    friend class PMRDeleter;
 
 public:
     explicit PMRDeleter(std::pmr::memory_resource* resource)
-        : resource_(resource) {
+        : resource_(resource), size_(sizeof(T)), alignment_(alignof(T)) {
+    }
+
+    // Upcast (e.g. PosixSocket -> Socket) Keeps the Derived Allocation Size
+    template<typename U>
+        requires std::is_convertible_v<U*, T*>
+    PMRDeleter(const PMRDeleter<U>& other)
+        : resource_(other.resource_), size_(other.size_), alignment_(other.alignment_) {
     }
 
     void operator()(T* ptr) const {
@@ -17,7 +31,7 @@ public:
             ptr->~T();
 
             // Deallocate memory
-            resource_->deallocate(ptr, sizeof(T), alignof(T));
+            resource_->deallocate(ptr, size_, alignment_);
         }
     }
 };
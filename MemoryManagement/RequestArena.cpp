@@ -0,0 +1,90 @@
+#include "RequestArena.h"
+#include <algorithm>
+#include <cstdint>
+
+RequestArena::RequestArena(size_t capacity, std::pmr::memory_resource* upstream)
+    : upstream_(upstream),
+    buffer_(static_cast<std::byte*>(upstream->allocate(capacity, alignof(std::max_align_t)))),
+    capacity_(capacity),
+    offset_(0),
+    overflow_(nullptr),
+    overflowBytes_(0),
+    overflowCount_(0),
+    highWater_(0)
+{
+
+}
+
+RequestArena::~RequestArena() {
+    releaseOverflow();
+    upstream_->deallocate(buffer_, capacity_, alignof(std::max_align_t));
+}
+
+void RequestArena::reset() {
+    highWater_ = std::max(highWater_, bytesInUse());
+    offset_ = 0;
+
+    // Only Requests That Outgrew the Buffer Pay More Than the Rewind
+    if (overflow_) {
+        releaseOverflow();
+    }
+}
+
+size_t RequestArena::capacity() const {
+    return capacity_;
+}
+
+size_t RequestArena::bytesInUse() const {
+    return offset_ + overflowBytes_;
+}
+
+size_t RequestArena::highWaterMark() const {
+    return std::max(highWater_, bytesInUse());
+}
+
+size_t RequestArena::overflowCount() const {
+    return overflowCount_;
+}
+
+void* RequestArena::do_allocate(size_t bytes, size_t alignment) {
+    // Bump Within the Buffer
+    auto base = reinterpret_cast<uintptr_t>(buffer_);
+    size_t aligned = ((base + offset_ + alignment - 1) & ~(uintptr_t(alignment) - 1)) - base;
+    if (aligned <= capacity_ && bytes <= capacity_ - aligned) {
+        offset_ = aligned + bytes;
+        return buffer_ + aligned;
+    }
+
+    // Overflow: Header Padded to alignment, Then the Block
+    size_t blockAlignment = std::max(alignof(Overflow), alignment);
+    size_t headerSize = (sizeof(Overflow) + blockAlignment - 1) & ~(blockAlignment - 1);
+    auto* block = static_cast<std::byte*>(upstream_->allocate(headerSize + bytes, blockAlignment));
+
+    auto* header = reinterpret_cast<Overflow*>(block + headerSize - sizeof(Overflow));
+    header->next = overflow_;
+    header->block = block;
+    header->size = headerSize + bytes;
+    header->alignment = blockAlignment;
+    overflow_ = header;
+
+    overflowBytes_ += bytes;
+    ++overflowCount_;
+    return block + headerSize;
+}
+
+void RequestArena::do_deallocate([[maybe_unused]] void* ptr, [[maybe_unused]] size_t bytes, [[maybe_unused]] size_t alignment) {
+    // Reclaimed in Bulk by reset()
+}
+
+bool RequestArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+void RequestArena::releaseOverflow() {
+    while (overflow_) {
+        Overflow* header = overflow_;
+        overflow_ = header->next;
+        upstream_->deallocate(header->block, header->size, header->alignment);
+    }
+    overflowBytes_ = 0;
+}
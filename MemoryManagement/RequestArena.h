@@ -0,0 +1,64 @@
+#pragma once
+
+#if !defined(_WIN32)
+#define MEM_MANAGER
+#elif defined(MEM_MANAGER_EXPORTS)
+#define MEM_MANAGER __declspec(dllexport)
+#else
+#define MEM_MANAGER __declspec(dllimport)
+#endif
+
+#include <memory_resource>
+#include <cstddef>
+
+// Bump Arena for Memory That Dies Together (One Request's Worth)
+//
+// Allocations Advance a Pointer Through a Fixed Buffer Taken From upstream
+// Once; deallocate() is a No-Op and reset() Rewinds Everything at Once.
+// What Does Not Fit Goes to upstream and is Returned on reset(), so a
+// Long-Lived Owner's Footprint Stays at the Buffer Size. Not Thread-Safe.
+class MEM_MANAGER RequestArena : public std::pmr::memory_resource {
+public:
+    RequestArena(size_t capacity, std::pmr::memory_resource* upstream);
+    ~RequestArena();
+
+    // Nothing Allocated Since the Last reset() May Be Used Afterwards
+    void reset();
+
+    size_t capacity() const;
+    size_t bytesInUse() const;          // Since the Last reset(), Overflow Included
+    size_t highWaterMark() const;       // Largest bytesInUse() Ever Reached
+    size_t overflowCount() const;       // Allocations That Missed the Buffer, Ever
+
+    // Delete Copy/Move Operations
+    RequestArena(const RequestArena&) = delete;
+    RequestArena& operator=(const RequestArena&) = delete;
+    RequestArena(RequestArena&&) = delete;
+    RequestArena& operator=(RequestArena&&) = delete;
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+    // Prefix of Every Overflow Block, Chaining Them for reset()
+    struct Overflow {
+        Overflow* next;
+        void* block;            // Start of the Upstream Allocation
+        size_t size;
+        size_t alignment;
+    };
+
+    void releaseOverflow();
+
+    std::pmr::memory_resource* upstream_;
+    std::byte* buffer_;
+    size_t capacity_;
+    size_t offset_;
+
+    Overflow* overflow_;
+    size_t overflowBytes_;
+    size_t overflowCount_;
+    size_t highWater_;
+};
@@ -0,0 +1,197 @@
+#include "SessionArenaPool.h"
+#include <new>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    constexpr size_t HugePageSize = 2 * 1024 * 1024;
+
+    size_t pageSize() {
+#ifdef _WIN32
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return info.dwPageSize;
+#else
+        return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+    }
+
+    size_t roundUp(size_t value, size_t multiple) {
+        return (value + multiple - 1) / multiple * multiple;
+    }
+}
+
+SessionArenaPool::SessionArenaPool(const Config& config)
+    : config_(config),
+    stride_(roundUp(config.arenaSize, pageSize())),
+    mappingSize_(0),
+    base_(nullptr),
+    hugePages_(false),
+    next_(std::make_unique<std::atomic<uint32_t>[]>(config.arenaCount)),
+    head_(pack(0, EmptyIndex)),
+    available_(config.arenaCount),
+    exhausted_(0)
+{
+    if (config_.arenaCount == 0 || config_.arenaCount >= EmptyIndex) {
+        available_ = 0;
+        return;
+    }
+
+    map();
+
+    // Fault Every Page in Now, Not on Each Connection's First Request
+    if (config_.prefault) {
+        size_t step = pageSize();
+        for (size_t offset = 0; offset < mappingSize_; offset += step) {
+            base_[offset] = std::byte{ 0 };
+        }
+    }
+
+    // Chain Arenas in Address Order: 0 -> 1 -> ... -> Empty
+    for (uint32_t i = 0; i < config_.arenaCount; ++i) {
+        next_[i].store(i + 1 < config_.arenaCount ? i + 1 : EmptyIndex, std::memory_order_relaxed);
+    }
+    head_.store(pack(0, 0), std::memory_order_release);
+}
+
+SessionArenaPool::~SessionArenaPool() {
+    unmap();
+}
+
+std::byte* SessionArenaPool::acquire() {
+    uint64_t head = head_.load(std::memory_order_acquire);
+    while (indexOf(head) != EmptyIndex) {
+        uint32_t index = indexOf(head);
+        uint32_t next = next_[index].load(std::memory_order_relaxed);
+
+        // A Stale next is Harmless: the Tag Has Moved and the CAS Fails
+        if (head_.compare_exchange_weak(head, pack(tagOf(head) + 1, next),
+            std::memory_order_acquire, std::memory_order_acquire)) {
+            available_.fetch_sub(1, std::memory_order_relaxed);
+            return base_ + index * stride_;
+        }
+    }
+
+    exhausted_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+}
+
+void SessionArenaPool::release(std::byte* arena) {
+    auto index = static_cast<uint32_t>((arena - base_) / stride_);
+
+    uint64_t head = head_.load(std::memory_order_relaxed);
+    do {
+        next_[index].store(indexOf(head), std::memory_order_relaxed);
+    } while (!head_.compare_exchange_weak(head, pack(tagOf(head) + 1, index),
+        std::memory_order_release, std::memory_order_relaxed));
+
+    available_.fetch_add(1, std::memory_order_relaxed);
+}
+
+const SessionArenaPool::Config& SessionArenaPool::config() const {
+    return config_;
+}
+
+bool SessionArenaPool::usesHugePages() const {
+    return hugePages_;
+}
+
+size_t SessionArenaPool::available() const {
+    return available_.load(std::memory_order_relaxed);
+}
+
+size_t SessionArenaPool::exhaustedCount() const {
+    return exhausted_.load(std::memory_order_relaxed);
+}
+
+uint64_t SessionArenaPool::pack(uint32_t tag, uint32_t index) {
+    return (static_cast<uint64_t>(tag) << 32) | index;
+}
+
+uint32_t SessionArenaPool::indexOf(uint64_t head) {
+    return static_cast<uint32_t>(head);
+}
+
+uint32_t SessionArenaPool::tagOf(uint64_t head) {
+    return static_cast<uint32_t>(head >> 32);
+}
+
+void SessionArenaPool::map() {
+    size_t size = stride_ * config_.arenaCount;
+
+#ifdef _WIN32
+    // Large Pages Need SeLockMemoryPrivilege; Without it, Normal Pages
+    if (config_.hugePages) {
+        size_t largePage = GetLargePageMinimum();
+        if (largePage > 0) {
+            size_t largeSize = roundUp(size, largePage);
+            void* memory = VirtualAlloc(nullptr, largeSize,
+                MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+            if (memory) {
+                base_ = static_cast<std::byte*>(memory);
+                mappingSize_ = largeSize;
+                hugePages_ = true;
+                return;
+            }
+        }
+    }
+
+    void* memory = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    if (!memory) {
+        throw std::bad_alloc();
+    }
+    base_ = static_cast<std::byte*>(memory);
+    mappingSize_ = size;
+#else
+    if (config_.hugePages) {
+        size = roundUp(size, HugePageSize);
+
+#ifdef MAP_HUGETLB
+        // Reserved Huge Pages First; Usually None are Configured
+        void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (memory != MAP_FAILED) {
+            base_ = static_cast<std::byte*>(memory);
+            mappingSize_ = size;
+            hugePages_ = true;
+            return;
+        }
+#endif
+    }
+
+    void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+    base_ = static_cast<std::byte*>(memory);
+    mappingSize_ = size;
+
+#ifdef MADV_HUGEPAGE
+    // Then Transparent Huge Pages, Before the Prefault Touches Anything
+    if (config_.hugePages) {
+        hugePages_ = madvise(memory, size, MADV_HUGEPAGE) == 0;
+    }
+#endif
+#endif
+}
+
+void SessionArenaPool::unmap() {
+    if (!base_) {
+        return;
+    }
+
+#ifdef _WIN32
+    VirtualFree(base_, 0, MEM_RELEASE);
+#else
+    munmap(base_, mappingSize_);
+#endif
+    base_ = nullptr;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#if !defined(_WIN32)
+#define MEM_MANAGER
+#elif defined(MEM_MANAGER_EXPORTS)
+#define MEM_MANAGER __declspec(dllexport)
+#else
+#define MEM_MANAGER __declspec(dllimport)
+#endif
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+// Fixed Set of Pre-Sized Session Arenas, Checked Out per Connection
+//
+// All Arenas Come From One Mapping Made at Construction (Optionally Huge
+// Pages, Optionally Touched Up Front), so Connection Churn Reuses Memory
+// That is Already Resident Instead of Faulting in Fresh Heap. The Free List
+// is a Lock-Free Stack of Indices Whose Head Carries a Tag Against ABA.
+class MEM_MANAGER SessionArenaPool {
+public:
+    // What createClientResource Does When Every Arena is Checked Out
+    enum class Overflow {
+        Heap,       // Fall Back to a Per-Connection Heap Arena
+        Reject      // Hand Out Nothing; the Server Sheds the Connection
+    };
+
+    struct Config {
+        size_t arenaCount = 0;                  // 0 Disables Pooling
+        size_t arenaSize = 1000 * 1024;
+        bool hugePages = false;                 // Best Effort; Falls Back to Normal Pages
+        bool prefault = true;                   // Touch Every Page at Startup
+        Overflow overflow = Overflow::Heap;
+    };
+
+    explicit SessionArenaPool(const Config& config);
+    ~SessionArenaPool();
+
+    // nullptr When Every Arena is Checked Out
+    std::byte* acquire();
+    void release(std::byte* arena);
+
+    const Config& config() const;
+    bool usesHugePages() const;
+    size_t available() const;
+    size_t exhaustedCount() const;      // acquire() Calls That Found the Pool Empty
+
+    // Delete Copy/Move Operations
+    SessionArenaPool(const SessionArenaPool&) = delete;
+    SessionArenaPool& operator=(const SessionArenaPool&) = delete;
+    SessionArenaPool(SessionArenaPool&&) = delete;
+    SessionArenaPool& operator=(SessionArenaPool&&) = delete;
+
+private:
+    static constexpr uint32_t EmptyIndex = UINT32_MAX;
+
+    // Head: Tag in the High Half, Index of the First Free Arena in the Low Half
+    static uint64_t pack(uint32_t tag, uint32_t index);
+    static uint32_t indexOf(uint64_t head);
+    static uint32_t tagOf(uint64_t head);
+
+    void map();
+    void unmap();
+
+    Config config_;
+    size_t stride_;                     // arenaSize Rounded to a Page
+    size_t mappingSize_;
+    std::byte* base_;
+    bool hugePages_;
+
+    std::unique_ptr<std::atomic<uint32_t>[]> next_;
+    std::atomic<uint64_t> head_;
+    std::atomic<size_t> available_;
+    std::atomic<size_t> exhausted_;
+};
@@ -0,0 +1,360 @@
+#include "ThreadCachingResource.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <mutex>
+#include <vector>
+
+namespace {
+    // 16..128 in Steps of 16, Then Four Classes per Doubling up to MaxSmallSize
+    constexpr size_t ClassCount = 40;
+    constexpr size_t SlabAlignment = 64;
+
+    struct FreeObject {
+        FreeObject* next;
+    };
+
+    struct FreeList {
+        FreeObject* head = nullptr;
+        size_t count = 0;
+
+        void push(FreeObject* object) {
+            object->next = head;
+            head = object;
+            ++count;
+        }
+
+        FreeObject* pop() {
+            FreeObject* object = head;
+            head = object->next;
+            --count;
+            return object;
+        }
+    };
+
+    // Owned and Touched Only by its Thread; cachedBytes is Read by stats()
+    struct ThreadCache {
+        FreeList lists[ClassCount];
+        std::atomic<size_t> cachedBytes{ 0 };
+
+        void addCached(ptrdiff_t delta) {
+            cachedBytes.store(cachedBytes.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+        }
+    };
+
+    // Objects Moved per Refill or Spill: Fewer for Bigger Classes
+    size_t batchSize(size_t index) {
+        return std::clamp<size_t>(8192 / ThreadCachingResource::classSize(index), 2, 32);
+    }
+
+    std::atomic<uint64_t> nextResourceId{ 1 };
+}
+
+struct ThreadCachingState {
+    struct Central {
+        std::mutex mutex;
+        FreeList list;
+    };
+
+    uint64_t id;
+    std::pmr::memory_resource* slabUpstream;
+    std::pmr::memory_resource* largeUpstream;
+
+    Central central[ClassCount];
+
+    std::mutex slabMutex;
+    std::vector<void*> slabs;
+
+    // alive Flips Under registryMutex; Exiting Threads Check it Before Flushing
+    std::mutex registryMutex;
+    std::vector<ThreadCache*> caches;
+    std::atomic<bool> alive{ true };
+
+    std::atomic<size_t> bytesReserved{ 0 };
+    std::atomic<size_t> centralBytes{ 0 };
+    std::atomic<size_t> tailBytes{ 0 };
+    std::atomic<size_t> largeBytes{ 0 };
+    std::atomic<size_t> transfers{ 0 };
+    std::atomic<size_t> contended{ 0 };
+
+    std::unique_lock<std::mutex> lockCentral(size_t index) {
+        auto& mutex = central[index].mutex;
+        if (!mutex.try_lock()) {
+            contended.fetch_add(1, std::memory_order_relaxed);
+            mutex.lock();
+        }
+        return std::unique_lock<std::mutex>(mutex, std::adopt_lock);
+    }
+
+    // Central Lock for index Held
+    void carveSlab(size_t index) {
+        void* slab;
+        {
+            std::lock_guard<std::mutex> lock(slabMutex);
+            slab = slabUpstream->allocate(ThreadCachingResource::SlabSize, SlabAlignment);
+            slabs.push_back(slab);
+        }
+
+        size_t size = ThreadCachingResource::classSize(index);
+        size_t count = ThreadCachingResource::SlabSize / size;
+        auto* bytes = static_cast<std::byte*>(slab);
+
+        // Pushed Back to Front so Allocation Walks the Slab Upwards
+        auto& list = central[index].list;
+        for (size_t i = count; i-- > 0;) {
+            list.push(reinterpret_cast<FreeObject*>(bytes + i * size));
+        }
+
+        bytesReserved.fetch_add(ThreadCachingResource::SlabSize, std::memory_order_relaxed);
+        centralBytes.fetch_add(count * size, std::memory_order_relaxed);
+        tailBytes.fetch_add(ThreadCachingResource::SlabSize - count * size, std::memory_order_relaxed);
+    }
+
+    void refill(ThreadCache& cache, size_t index) {
+        auto lock = lockCentral(index);
+        auto& list = central[index].list;
+        if (list.count == 0) {
+            carveSlab(index);
+        }
+
+        size_t moved = std::min(batchSize(index), list.count);
+        for (size_t i = 0; i < moved; ++i) {
+            cache.lists[index].push(list.pop());
+        }
+
+        size_t bytes = moved * ThreadCachingResource::classSize(index);
+        centralBytes.fetch_sub(bytes, std::memory_order_relaxed);
+        cache.addCached(static_cast<ptrdiff_t>(bytes));
+        transfers.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void spill(ThreadCache& cache, size_t index, size_t count) {
+        auto lock = lockCentral(index);
+        auto& list = central[index].list;
+        for (size_t i = 0; i < count; ++i) {
+            list.push(cache.lists[index].pop());
+        }
+
+        size_t bytes = count * ThreadCachingResource::classSize(index);
+        centralBytes.fetch_add(bytes, std::memory_order_relaxed);
+        cache.addCached(-static_cast<ptrdiff_t>(bytes));
+        transfers.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Thread Exit: Hand Cached Objects Back While the Resource Lives
+    void retire(ThreadCache* cache) {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        if (alive.load(std::memory_order_relaxed)) {
+            for (size_t index = 0; index < ClassCount; ++index) {
+                if (cache->lists[index].count > 0) {
+                    spill(*cache, index, cache->lists[index].count);
+                }
+            }
+            caches.erase(std::find(caches.begin(), caches.end(), cache));
+        }
+        delete cache;
+    }
+};
+
+namespace {
+    struct CacheEntry {
+        uint64_t id;
+        std::shared_ptr<ThreadCachingState> state;
+        ThreadCache* cache;
+    };
+
+    struct ThreadCaches {
+        std::vector<CacheEntry> entries;
+        uint64_t lastId = 0;
+        ThreadCache* lastCache = nullptr;
+
+        ~ThreadCaches();
+
+        ThreadCache* lookup(const std::shared_ptr<ThreadCachingState>& state);
+    };
+
+    thread_local ThreadCaches threadCaches;
+
+    // Trivially Destructible, so Still Readable After threadCaches is Gone
+    thread_local bool threadCachesGone = false;
+
+    ThreadCaches::~ThreadCaches() {
+        threadCachesGone = true;
+        for (auto& entry : entries) {
+            entry.state->retire(entry.cache);
+        }
+    }
+
+    ThreadCache* ThreadCaches::lookup(const std::shared_ptr<ThreadCachingState>& state) {
+        ThreadCache* found = nullptr;
+
+        // Drop Caches of Destroyed Resources While Scanning
+        for (auto it = entries.begin(); it != entries.end();) {
+            if (!it->state->alive.load(std::memory_order_acquire)) {
+                delete it->cache;
+                it = entries.erase(it);
+                continue;
+            }
+            if (it->id == state->id) {
+                found = it->cache;
+            }
+            ++it;
+        }
+
+        if (!found) {
+            found = new ThreadCache();
+            {
+                std::lock_guard<std::mutex> lock(state->registryMutex);
+                state->caches.push_back(found);
+            }
+            entries.push_back(CacheEntry{ state->id, state, found });
+        }
+
+        lastId = state->id;
+        lastCache = found;
+        return found;
+    }
+
+    // nullptr Only While This Thread's Thread-Locals are Being Destroyed
+    ThreadCache* localCache(const std::shared_ptr<ThreadCachingState>& state) {
+        if (threadCachesGone) {
+            return nullptr;
+        }
+        auto& caches = threadCaches;
+        if (caches.lastId == state->id) {
+            return caches.lastCache;
+        }
+        return caches.lookup(state);
+    }
+}
+
+ThreadCachingResource::ThreadCachingResource(std::pmr::memory_resource* slabUpstream, std::pmr::memory_resource* largeUpstream)
+    : state_(std::make_shared<ThreadCachingState>())
+{
+    state_->id = nextResourceId.fetch_add(1, std::memory_order_relaxed);
+    state_->slabUpstream = slabUpstream;
+    state_->largeUpstream = largeUpstream;
+}
+
+ThreadCachingResource::~ThreadCachingResource() {
+    {
+        // Threads Still Holding Caches Find alive False and Just Free Them
+        std::lock_guard<std::mutex> lock(state_->registryMutex);
+        state_->alive.store(false, std::memory_order_release);
+        state_->caches.clear();
+    }
+
+    std::lock_guard<std::mutex> lock(state_->slabMutex);
+    for (void* slab : state_->slabs) {
+        state_->slabUpstream->deallocate(slab, SlabSize, SlabAlignment);
+    }
+    state_->slabs.clear();
+}
+
+ThreadCachingResource::Stats ThreadCachingResource::stats() const {
+    Stats stats{};
+
+    size_t threadCached = 0;
+    {
+        std::lock_guard<std::mutex> lock(state_->registryMutex);
+        for (ThreadCache* cache : state_->caches) {
+            threadCached += cache->cachedBytes.load(std::memory_order_relaxed);
+        }
+        stats.threadCaches = state_->caches.size();
+    }
+
+    stats.bytesReserved = state_->bytesReserved.load(std::memory_order_relaxed);
+    stats.bytesCached = state_->centralBytes.load(std::memory_order_relaxed) + threadCached;
+    stats.bytesSlabTails = state_->tailBytes.load(std::memory_order_relaxed);
+
+    // Counters are Read Separately, so Clamp a Momentarily Inconsistent View
+    size_t unavailable = stats.bytesCached + stats.bytesSlabTails;
+    stats.bytesInUse = stats.bytesReserved > unavailable ? stats.bytesReserved - unavailable : 0;
+    stats.largeBytesInUse = state_->largeBytes.load(std::memory_order_relaxed);
+    stats.centralTransfers = state_->transfers.load(std::memory_order_relaxed);
+    stats.contendedLocks = state_->contended.load(std::memory_order_relaxed);
+    return stats;
+}
+
+size_t ThreadCachingResource::classIndex(size_t bytes) {
+    bytes = std::max<size_t>(bytes, 1);
+    if (bytes <= 128) {
+        return (bytes + 15) / 16 - 1;
+    }
+
+    // bytes in (2^(lg-1), 2^lg], Split Into Four Steps of 2^(lg-3)
+    size_t lg = std::bit_width(bytes - 1);
+    return 8 + (lg - 8) * 4 + ((bytes - 1) >> (lg - 3)) - 4;
+}
+
+size_t ThreadCachingResource::classSize(size_t index) {
+    if (index < 8) {
+        return (index + 1) * 16;
+    }
+
+    size_t step = index - 8;
+    size_t lg = 8 + step / 4;
+    return (size_t(1) << (lg - 1)) + (size_t(1) << (lg - 3)) * (step % 4 + 1);
+}
+
+void* ThreadCachingResource::do_allocate(size_t bytes, size_t alignment) {
+    if (bytes > MaxSmallSize || alignment > SmallAlignment) {
+        void* ptr = state_->largeUpstream->allocate(bytes, alignment);
+        state_->largeBytes.fetch_add(bytes, std::memory_order_relaxed);
+        return ptr;
+    }
+
+    size_t index = classIndex(bytes);
+    ThreadCache* cache = localCache(state_);
+
+    // Fast Path: Pop the Thread's Own List
+    if (cache) {
+        auto& list = cache->lists[index];
+        if (list.count == 0) {
+            state_->refill(*cache, index);
+        }
+        cache->addCached(-static_cast<ptrdiff_t>(classSize(index)));
+        return list.pop();
+    }
+
+    // Thread Shutting Down: One Object Straight From the Central List
+    auto lock = state_->lockCentral(index);
+    auto& list = state_->central[index].list;
+    if (list.count == 0) {
+        state_->carveSlab(index);
+    }
+    state_->centralBytes.fetch_sub(classSize(index), std::memory_order_relaxed);
+    return list.pop();
+}
+
+void ThreadCachingResource::do_deallocate(void* ptr, size_t bytes, size_t alignment) {
+    if (bytes > MaxSmallSize || alignment > SmallAlignment) {
+        state_->largeUpstream->deallocate(ptr, bytes, alignment);
+        state_->largeBytes.fetch_sub(bytes, std::memory_order_relaxed);
+        return;
+    }
+
+    size_t index = classIndex(bytes);
+    ThreadCache* cache = localCache(state_);
+
+    if (cache) {
+        auto& list = cache->lists[index];
+        list.push(static_cast<FreeObject*>(ptr));
+        cache->addCached(static_cast<ptrdiff_t>(classSize(index)));
+
+        // Keep at Most Two Batches; Spill One so the Next Free Does Not
+        size_t batch = batchSize(index);
+        if (list.count >= 2 * batch) {
+            state_->spill(*cache, index, batch);
+        }
+        return;
+    }
+
+    auto lock = state_->lockCentral(index);
+    state_->central[index].list.push(static_cast<FreeObject*>(ptr));
+    state_->centralBytes.fetch_add(classSize(index), std::memory_order_relaxed);
+}
+
+bool ThreadCachingResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
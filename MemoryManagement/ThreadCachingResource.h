@@ -0,0 +1,67 @@
+#pragma once
+
+#if !defined(_WIN32)
+#define MEM_MANAGER
+#elif defined(MEM_MANAGER_EXPORTS)
+#define MEM_MANAGER __declspec(dllexport)
+#else
+#define MEM_MANAGER __declspec(dllimport)
+#endif
+
+#include <memory_resource>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+struct ThreadCachingState;
+
+// Scalable Shared Resource: Size-Class Slabs Behind Per-Thread Caches
+//
+// Small Requests Round Up to One of ~40 Size Classes. Each Thread Keeps a
+// Short Free List per Class, so the Common Allocate/Deallocate Touches No
+// Lock; Lists Refill From and Spill To Mutex-Guarded Central Lists in
+// Batches. Slabs Come From slabUpstream and are Reused, Never Returned
+// Until Destruction; Anything Larger Goes Straight to largeUpstream.
+class MEM_MANAGER ThreadCachingResource : public std::pmr::memory_resource {
+public:
+    static constexpr size_t MaxSmallSize = 32 * 1024;
+    static constexpr size_t SmallAlignment = 16;
+    static constexpr size_t SlabSize = 64 * 1024;
+
+    struct Stats {
+        size_t bytesReserved;       // Slabs Taken From slabUpstream
+        size_t bytesCached;         // Free in Central Lists and Thread Caches
+        size_t bytesSlabTails;      // Slab Remainders Too Small for One More Object
+        size_t bytesInUse;          // Reserved Minus Cached and Tails: Handed Out, Class-Rounded
+        size_t largeBytesInUse;     // Outstanding Straight-to-Upstream Allocations
+        size_t centralTransfers;    // Batches Moved Between Thread and Central Lists
+        size_t contendedLocks;      // Central Lock Acquisitions That Had to Wait
+        size_t threadCaches;        // Threads Currently Holding a Cache
+    };
+
+    explicit ThreadCachingResource(
+        std::pmr::memory_resource* slabUpstream = std::pmr::get_default_resource(),
+        std::pmr::memory_resource* largeUpstream = std::pmr::get_default_resource()
+    );
+    ~ThreadCachingResource();
+
+    Stats stats() const;
+
+    // Size Classes, Exposed for Tests and Benchmarks
+    static size_t classIndex(size_t bytes);
+    static size_t classSize(size_t index);
+
+    // Delete Copy/Move Operations
+    ThreadCachingResource(const ThreadCachingResource&) = delete;
+    ThreadCachingResource& operator=(const ThreadCachingResource&) = delete;
+    ThreadCachingResource(ThreadCachingResource&&) = delete;
+    ThreadCachingResource& operator=(ThreadCachingResource&&) = delete;
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+    std::shared_ptr<ThreadCachingState> state_;     // Shared With Exiting Threads
+};
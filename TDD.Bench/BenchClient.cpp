@@ -0,0 +1,148 @@
+#include "BenchClient.h"
+#ifdef _WIN32
+#include "WinsockSocket.h"
+#include <windows.h>
+#else
+#include "PosixSocket.h"
+#include <sys/resource.h>
+#endif
+#include <algorithm>
+#include <string_view>
+#include <cctype>
+#include <cmath>
+
+namespace Bench {
+    namespace {
+        constexpr std::string_view HeaderTerminator = "\r\n\r\n";
+
+        std::optional<size_t> findContentLength(std::string_view headers) {
+            constexpr std::string_view name = "content-length:";
+            for (size_t i = 0; i + name.size() <= headers.size(); ++i) {
+                bool match = true;
+                for (size_t j = 0; j < name.size(); ++j) {
+                    if (std::tolower(static_cast<unsigned char>(headers[i + j])) != name[j]) {
+                        match = false;
+                        break;
+                    }
+                }
+                if (match) {
+                    size_t pos = i + name.size();
+                    while (pos < headers.size() && headers[pos] == ' ') ++pos;
+                    size_t value = 0;
+                    while (pos < headers.size() && std::isdigit(static_cast<unsigned char>(headers[pos]))) {
+                        value = value * 10 + static_cast<size_t>(headers[pos++] - '0');
+                    }
+                    return value;
+                }
+            }
+            return std::nullopt;
+        }
+    }
+
+    BenchClient::BenchClient(std::pmr::memory_resource* resource)
+        : resource_(resource),
+        pending_(resource),
+        readBuffer_(16384, resource) {
+    }
+
+    bool BenchClient::connect(const std::pmr::string& address, uint16_t port) {
+#ifdef _WIN32
+        socket_ = std::make_unique<WinsockSocket>(resource_);
+#else
+        socket_ = std::make_unique<PosixSocket>(resource_);
+#endif
+        if (socket_->init().type != SocketError::Type::None) {
+            return false;
+        }
+        return socket_->connect(address, port).type == SocketError::Type::None;
+    }
+
+    bool BenchClient::sendRequest(const std::pmr::vector<uint8_t>& request) {
+        return socket_ && socket_->send(request).type == SocketError::Type::None;
+    }
+
+    bool BenchClient::readResponse() {
+        if (!socket_) return false;
+
+        while (true) {
+            std::string_view view(reinterpret_cast<const char*>(pending_.data()), pending_.size());
+            auto headerEnd = view.find(HeaderTerminator);
+            if (headerEnd != std::string_view::npos) {
+                size_t bodyLength = findContentLength(view.substr(0, headerEnd)).value_or(0);
+                size_t total = headerEnd + HeaderTerminator.size() + bodyLength;
+                if (pending_.size() >= total) {
+                    pending_.erase(pending_.begin(), pending_.begin() + total);
+                    return true;
+                }
+            }
+
+            auto receiveResult = socket_->receiveInto(readBuffer_);
+            if (!receiveResult.has_value() || receiveResult.value() == 0) {
+                return false;
+            }
+            pending_.insert(pending_.end(), readBuffer_.begin(), readBuffer_.begin() + receiveResult.value());
+        }
+    }
+
+    void BenchClient::close() {
+        if (socket_) {
+            socket_->close();
+            socket_.reset();
+        }
+        pending_.clear();
+    }
+
+    std::pmr::vector<uint8_t> makeGetRequest(const std::pmr::string& path, std::pmr::memory_resource* resource) {
+        std::pmr::string request(resource);
+        request += "GET ";
+        request += path;
+        request += " HTTP/1.1\r\nHost: 127.0.0.1\r\nConnection: keep-alive\r\n\r\n";
+        return std::pmr::vector<uint8_t>(request.begin(), request.end(), resource);
+    }
+
+    std::pmr::vector<uint8_t> makeRequest(const std::pmr::string& path, size_t bodySize, bool keepAlive, std::pmr::memory_resource* resource) {
+        std::pmr::string request(resource);
+        request += bodySize == 0 ? "GET " : "POST ";
+        request += path;
+        request += " HTTP/1.1\r\nHost: 127.0.0.1\r\n";
+        request += keepAlive ? "Connection: keep-alive\r\n" : "Connection: close\r\n";
+        if (bodySize != 0) {
+            request += "Content-Length: ";
+            request += std::to_string(bodySize);
+            request += "\r\n";
+        }
+        request += "\r\n";
+        request.append(bodySize, 'x');
+        return std::pmr::vector<uint8_t>(request.begin(), request.end(), resource);
+    }
+
+    std::chrono::microseconds processCpuTime() {
+#ifdef _WIN32
+        FILETIME creation, exit, kernel, user;
+        GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user);
+        auto toMicros = [](const FILETIME& ft) {
+            ULARGE_INTEGER value;
+            value.LowPart = ft.dwLowDateTime;
+            value.HighPart = ft.dwHighDateTime;
+            return static_cast<int64_t>(value.QuadPart / 10);  // 100ns Ticks
+        };
+        return std::chrono::microseconds(toMicros(kernel) + toMicros(user));
+#else
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        auto toMicros = [](const timeval& tv) {
+            return static_cast<int64_t>(tv.tv_sec) * 1000000 + tv.tv_usec;
+        };
+        return std::chrono::microseconds(toMicros(usage.ru_utime) + toMicros(usage.ru_stime));
+#endif
+    }
+
+    std::chrono::nanoseconds percentile(std::vector<std::chrono::nanoseconds>& samples, double p) {
+        if (samples.empty()) return std::chrono::nanoseconds(0);
+
+        std::sort(samples.begin(), samples.end());
+        size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * static_cast<double>(samples.size())));
+        rank = std::clamp<size_t>(rank, 1, samples.size());
+        return samples[rank - 1];
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Socket.h"
+#include "PMRDeleter.h"
+#include <memory>
+#include <memory_resource>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <optional>
+#include <cstdint>
+
+namespace Bench {
+    // Blocking Loopback HTTP/1.1 Client Connection
+    class BenchClient {
+    public:
+        explicit BenchClient(std::pmr::memory_resource* resource);
+
+        bool connect(const std::pmr::string& address, uint16_t port);
+        bool sendRequest(const std::pmr::vector<uint8_t>& request);
+
+        // Reads One Complete Response (Headers + Content-Length Body)
+        bool readResponse();
+
+        void close();
+
+    private:
+        std::pmr::memory_resource* resource_;
+        std::unique_ptr<Socket> socket_;
+        std::pmr::vector<uint8_t> pending_;
+        std::pmr::vector<uint8_t> readBuffer_;
+    };
+
+    std::pmr::vector<uint8_t> makeGetRequest(const std::pmr::string& path, std::pmr::memory_resource* resource);
+
+    // GET When bodySize is 0, Otherwise POST With a bodySize-Byte Body
+    std::pmr::vector<uint8_t> makeRequest(const std::pmr::string& path, size_t bodySize, bool keepAlive, std::pmr::memory_resource* resource);
+
+    // Process-Wide CPU Time (User + Kernel)
+    std::chrono::microseconds processCpuTime();
+
+    // Nearest-Rank Percentile Over Unsorted Samples (Sorts in Place)
+    std::chrono::nanoseconds percentile(std::vector<std::chrono::nanoseconds>& samples, double p);
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "ByteScanner.h"
+#include <vector>
+#include <cstddef>
+
+namespace Bench {
+    struct HeaderScanOptions {
+        size_t iterations = 200000;     // Passes Over the Request Corpus
+    };
+
+    struct HeaderScanResult {
+        ByteScanner::Kernel kernel;
+        double scanNsPerRequest;        // Delimiter Search Alone
+        double parseNsPerRequest;       // Full RequestParser::parse()
+        double parseMegabytesPerSecond;
+    };
+
+    // Runs the Same Corpus of Realistic Request Heads Through Every Kernel the CPU Supports
+    bool runHeaderScan(const HeaderScanOptions& options, std::vector<HeaderScanResult>& results);
+}
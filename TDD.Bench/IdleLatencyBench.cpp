@@ -0,0 +1,96 @@
+#include "IdleLatencyBench.h"
+#include "BenchClient.h"
+#include "BumpMemoryManager.h"
+#ifdef _WIN32
+#include "WinsockSocket.h"
+#else
+#include "PosixSocket.h"
+#endif
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace Bench {
+    namespace {
+#ifdef _WIN32
+        using PlatformSocket = WinsockSocket;
+#else
+        using PlatformSocket = PosixSocket;
+#endif
+    }
+
+    bool runIdleLatency(const IdleLatencyOptions& options, IdleLatencyResult& result) {
+        auto memoryManager = std::make_shared<BumpMemoryManager>(256 * 1024 * 1024);
+        auto* resource = memoryManager->getResource();
+
+        auto socketImpl = make_pmr_unique_ptr<PlatformSocket>(resource, resource);
+        std::unique_ptr<Socket, PMRDeleter<Socket>> socket(std::move(socketImpl));
+
+        HTTPServer::Config config;
+        config.connectionModel = options.model;
+        HTTPServer server(std::move(socket), memoryManager, config);
+
+        server.registerHandler(std::pmr::string("/", resource),
+            [](const HTTPServer::Request& req) -> HTTPServer::Response {
+                auto* reqResource = req.method.get_allocator().resource();
+                HTTPServer::Response res(200, {}, reqResource);
+                res.body = std::pmr::vector<uint8_t>({ 'O', 'K' }, reqResource);
+                return res;
+            });
+
+        std::pmr::string address("127.0.0.1", resource);
+        auto startResult = server.start(address, options.port);
+        if (startResult.type != SocketError::Type::None) {
+            std::cerr << "Failed to start server: " << startResult.internalCode << std::endl;
+            return false;
+        }
+
+        // Open and Warm Every Connection
+        auto request = makeGetRequest(std::pmr::string("/", resource), resource);
+        std::vector<std::unique_ptr<BenchClient>> clients;
+        for (size_t i = 0; i < options.connections; ++i) {
+            auto client = std::make_unique<BenchClient>(resource);
+            if (!client->connect(address, options.port) || !client->sendRequest(request) || !client->readResponse()) {
+                std::cerr << "Failed to open connection " << i << std::endl;
+                return false;
+            }
+            clients.push_back(std::move(client));
+        }
+
+        // Idle Phase: Only the Server Should be Burning CPU
+        auto cpuBefore = processCpuTime();
+        auto wallBefore = std::chrono::steady_clock::now();
+        std::this_thread::sleep_for(options.idleWindow);
+        auto cpuSpent = processCpuTime() - cpuBefore;
+        auto wallSpent = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - wallBefore);
+        result.idleCpuPercent = 100.0 * static_cast<double>(cpuSpent.count()) / static_cast<double>(wallSpent.count());
+
+        // Latency Phase: Round-Robin so Every Connection Stays Live
+        std::vector<std::chrono::nanoseconds> samples;
+        samples.reserve(options.connections * options.requestsPerConnection);
+        auto runStart = std::chrono::steady_clock::now();
+        for (size_t round = 0; round < options.requestsPerConnection; ++round) {
+            for (auto& client : clients) {
+                auto sent = std::chrono::steady_clock::now();
+                if (!client->sendRequest(request) || !client->readResponse()) {
+                    std::cerr << "Request failed" << std::endl;
+                    return false;
+                }
+                samples.push_back(std::chrono::steady_clock::now() - sent);
+            }
+        }
+        auto runTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - runStart);
+
+        result.requestsPerSecond = static_cast<double>(samples.size()) / runTime.count();
+        result.p50 = percentile(samples, 50.0);
+        result.p99 = percentile(samples, 99.0);
+        result.max = samples.back();
+
+        for (auto& client : clients) {
+            client->close();
+        }
+        server.stop();
+        return true;
+    }
+}
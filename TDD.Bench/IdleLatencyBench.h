@@ -0,0 +1,27 @@
+#pragma once
+
+#include "HTTPServer.h"
+#include <chrono>
+#include <cstdint>
+
+namespace Bench {
+    struct IdleLatencyOptions {
+        ConnectionModel model = ConnectionModel::ThreadPerSession;
+        size_t connections = 64;
+        std::chrono::seconds idleWindow{ 3 };
+        size_t requestsPerConnection = 200;
+        uint16_t port = 18080;
+    };
+
+    struct IdleLatencyResult {
+        double idleCpuPercent;      // Server CPU While All Connections Sit Idle
+        std::chrono::nanoseconds p50;
+        std::chrono::nanoseconds p99;
+        std::chrono::nanoseconds max;
+        double requestsPerSecond;
+    };
+
+    // Opens Keep-Alive Connections to an In-Process HTTPServer, Measures Idle
+    // CPU Burn, Then Round-Robin Request Latency Across Those Connections
+    bool runIdleLatency(const IdleLatencyOptions& options, IdleLatencyResult& result);
+}
@@ -0,0 +1,102 @@
+#include "LatencyHistogram.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace Bench {
+    LatencyHistogram::LatencyHistogram(uint64_t maxValue, int significantDigits)
+        : maxValue_(std::max<uint64_t>(maxValue, 2)),
+        total_(0),
+        max_(0) {
+        // Sub-Buckets per Range: Enough That Adjacent Values Differ by at Most
+        // One Part in 10^significantDigits
+        uint64_t singleUnitResolution = 2;
+        for (int i = 0; i < significantDigits; ++i) singleUnitResolution *= 10;
+        int subBucketCountMagnitude = static_cast<int>(std::bit_width(singleUnitResolution - 1));
+
+        subBucketHalfCountMagnitude_ = std::max(subBucketCountMagnitude, 1) - 1;
+        subBucketCount_ = uint64_t(1) << (subBucketHalfCountMagnitude_ + 1);
+        subBucketHalfCount_ = subBucketCount_ / 2;
+        subBucketMask_ = subBucketCount_ - 1;
+
+        // Ranges Until the Top One Reaches maxValue
+        size_t bucketCount = 1;
+        for (uint64_t smallestUntracked = subBucketCount_; smallestUntracked <= maxValue_; smallestUntracked <<= 1) {
+            ++bucketCount;
+            if (smallestUntracked > (UINT64_MAX >> 1)) break;
+        }
+        counts_.assign((bucketCount + 1) * subBucketHalfCount_, 0);
+    }
+
+    size_t LatencyHistogram::bucketIndex(uint64_t value) const {
+        // Position of the Highest Set Bit Above the First Range
+        int base = 64 - subBucketHalfCountMagnitude_ - 1;
+        return static_cast<size_t>(base - std::countl_zero(value | subBucketMask_));
+    }
+
+    size_t LatencyHistogram::countsIndex(uint64_t value) const {
+        size_t bucket = bucketIndex(value);
+        uint64_t subBucket = value >> bucket;
+        return ((bucket + 1) << subBucketHalfCountMagnitude_) + static_cast<size_t>(subBucket - subBucketHalfCount_);
+    }
+
+    uint64_t LatencyHistogram::valueAt(size_t index) const {
+        int64_t bucket = static_cast<int64_t>(index >> subBucketHalfCountMagnitude_) - 1;
+        uint64_t subBucket = (index & (subBucketHalfCount_ - 1)) + subBucketHalfCount_;
+        if (bucket < 0) {
+            subBucket -= subBucketHalfCount_;
+            bucket = 0;
+        }
+        return subBucket << bucket;
+    }
+
+    uint64_t LatencyHistogram::highestEquivalent(uint64_t value) const {
+        size_t bucket = bucketIndex(value);
+        uint64_t subBucket = value >> bucket;
+        if (subBucket >= subBucketCount_) ++bucket;
+        uint64_t rangeSize = uint64_t(1) << bucket;
+        uint64_t lowest = (value >> bucket) << bucket;
+        return lowest + rangeSize - 1;
+    }
+
+    void LatencyHistogram::record(uint64_t value) {
+        value = std::min(value, maxValue_);
+        ++counts_[countsIndex(value)];
+        ++total_;
+        max_ = std::max(max_, value);
+    }
+
+    void LatencyHistogram::merge(const LatencyHistogram& other) {
+        size_t length = std::min(counts_.size(), other.counts_.size());
+        for (size_t i = 0; i < length; ++i) {
+            counts_[i] += other.counts_[i];
+        }
+        total_ += other.total_;
+        max_ = std::max(max_, other.max_);
+    }
+
+    uint64_t LatencyHistogram::count() const {
+        return total_;
+    }
+
+    uint64_t LatencyHistogram::max() const {
+        return max_;
+    }
+
+    uint64_t LatencyHistogram::valueAtPercentile(double p) const {
+        if (total_ == 0) return 0;
+
+        p = std::clamp(p, 0.0, 100.0);
+        uint64_t rank = static_cast<uint64_t>(std::ceil(p / 100.0 * static_cast<double>(total_)));
+        rank = std::max<uint64_t>(rank, 1);
+
+        uint64_t seen = 0;
+        for (size_t i = 0; i < counts_.size(); ++i) {
+            seen += counts_[i];
+            if (seen >= rank) {
+                return std::min(highestEquivalent(valueAt(i)), max_);
+            }
+        }
+        return max_;
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace Bench {
+    // Log-Linear Latency Histogram (HdrHistogram Layout)
+    //
+    // Every Power-of-Two Range is Split Into the Same Number of Linear
+    // Sub-Buckets, so Each Value Keeps significantDigits Decimal Digits of
+    // Precision From 1 up to maxValue. Recording is a Few Bit Operations and
+    // an Increment, Memory is Fixed Regardless of Sample Count, and
+    // Per-Thread Histograms Merge Exactly.
+    class LatencyHistogram {
+    public:
+        // Defaults Cover 1 ns to One Hour at 3 Digits (~200 KB)
+        explicit LatencyHistogram(uint64_t maxValue = 3600ull * 1000 * 1000 * 1000, int significantDigits = 3);
+
+        // Values Above maxValue are Clamped to it
+        void record(uint64_t value);
+
+        // Same maxValue and significantDigits Required
+        void merge(const LatencyHistogram& other);
+
+        uint64_t count() const;
+        uint64_t max() const;
+
+        // Largest Value Equivalent (Within Precision) to the Sample at Rank p%
+        uint64_t valueAtPercentile(double p) const;
+
+    private:
+        size_t bucketIndex(uint64_t value) const;
+        size_t countsIndex(uint64_t value) const;
+        uint64_t valueAt(size_t index) const;
+        uint64_t highestEquivalent(uint64_t value) const;
+
+        uint64_t maxValue_;
+        int subBucketHalfCountMagnitude_;
+        uint64_t subBucketCount_;
+        uint64_t subBucketHalfCount_;
+        uint64_t subBucketMask_;
+        std::vector<uint64_t> counts_;
+        uint64_t total_;
+        uint64_t max_;
+    };
+}
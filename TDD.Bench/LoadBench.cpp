@@ -0,0 +1,260 @@
+#include "LoadBench.h"
+#include "BenchClient.h"
+#include "LatencyHistogram.h"
+#include "BumpMemoryManager.h"
+#ifdef _WIN32
+#include "WinsockSocket.h"
+#else
+#include "PosixSocket.h"
+#endif
+#include <iostream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+#include <memory>
+
+namespace Bench {
+    namespace {
+#ifdef _WIN32
+        using PlatformSocket = WinsockSocket;
+#else
+        using PlatformSocket = PosixSocket;
+#endif
+        using Clock = std::chrono::steady_clock;
+
+        struct Window {
+            Clock::time_point start;        // Sending Begins
+            Clock::time_point measureFrom;  // Warmup Over
+            Clock::time_point end;          // Sending Stops
+            Clock::duration interval;       // Per-Connection Send Interval (Zero: Closed Loop)
+        };
+
+        // One Connection's Load: Sender and Receiver Share the Queue of
+        // Scheduled Send Times, Which HTTP/1.1 Answers in Order
+        struct ConnectionLoad {
+            BenchClient client;
+            LatencyHistogram histogram;
+            uint64_t completed = 0;
+            uint64_t errors = 0;
+
+            std::mutex mutex;
+            std::condition_variable changed;
+            std::deque<Clock::time_point> outstanding;
+            bool sending = true;
+            bool failed = false;
+
+            explicit ConnectionLoad(std::pmr::memory_resource* resource) : client(resource) {}
+        };
+
+        void recordCompletion(ConnectionLoad& load, const Window& window, Clock::time_point scheduled, Clock::time_point done) {
+            if (done < window.measureFrom || done > window.end) return;
+            load.histogram.record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(done - scheduled).count()));
+            ++load.completed;
+        }
+
+        // Next Send Time: Immediately in a Closed Loop, Otherwise the Schedule
+        // Even if Already Past (Falling Behind Shows up as Latency)
+        Clock::time_point nextSendTime(const Window& window, Clock::time_point& next) {
+            if (window.interval == Clock::duration::zero()) {
+                return Clock::now();
+            }
+            Clock::time_point scheduled = next;
+            next += window.interval;
+            std::this_thread::sleep_until(scheduled);
+            return scheduled;
+        }
+
+        void sendLoop(ConnectionLoad& load, const Window& window, const std::pmr::vector<uint8_t>& request, size_t depth, Clock::time_point next) {
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(load.mutex);
+                    load.changed.wait(lock, [&] { return load.outstanding.size() < depth || load.failed; });
+                    if (load.failed) break;
+                }
+
+                Clock::time_point scheduled = nextSendTime(window, next);
+                if (scheduled >= window.end) break;
+
+                // Queued Before Sending: the Response Can Arrive Before send() Returns
+                {
+                    std::lock_guard<std::mutex> lock(load.mutex);
+                    load.outstanding.push_back(scheduled);
+                    load.changed.notify_all();
+                }
+                if (!load.client.sendRequest(request)) {
+                    std::lock_guard<std::mutex> lock(load.mutex);
+                    load.outstanding.pop_back();
+                    load.failed = true;
+                    ++load.errors;
+                    break;
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(load.mutex);
+            load.sending = false;
+            load.changed.notify_all();
+        }
+
+        void receiveLoop(ConnectionLoad& load, const Window& window) {
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(load.mutex);
+                    load.changed.wait(lock, [&] { return !load.outstanding.empty() || !load.sending; });
+                    if (load.outstanding.empty()) break;
+                }
+
+                bool received = load.client.readResponse();
+                auto done = Clock::now();
+
+                std::lock_guard<std::mutex> lock(load.mutex);
+                if (!received) {
+                    load.errors += load.outstanding.size();
+                    load.outstanding.clear();
+                    load.failed = true;
+                    load.changed.notify_all();
+                    break;
+                }
+                recordCompletion(load, window, load.outstanding.front(), done);
+                load.outstanding.pop_front();
+                load.changed.notify_all();
+            }
+        }
+
+        // Keep-Alive Off: Connect, Send, Read and Close for Every Request
+        void connectPerRequestLoop(ConnectionLoad& load, const Window& window, const std::pmr::string& address,
+            uint16_t port, const std::pmr::vector<uint8_t>& request, Clock::time_point next) {
+            while (true) {
+                Clock::time_point scheduled = nextSendTime(window, next);
+                if (scheduled >= window.end) break;
+
+                bool ok = load.client.connect(address, port)
+                    && load.client.sendRequest(request)
+                    && load.client.readResponse();
+                auto done = Clock::now();
+                load.client.close();
+
+                if (!ok) {
+                    ++load.errors;
+                    continue;
+                }
+                recordCompletion(load, window, scheduled, done);
+            }
+        }
+    }
+
+    bool runLoad(const LoadOptions& options, LoadResult& result) {
+        auto memoryManager = std::make_shared<BumpMemoryManager>(256 * 1024 * 1024);
+        auto* resource = memoryManager->getResource();
+
+        auto socketImpl = make_pmr_unique_ptr<PlatformSocket>(resource, resource);
+        std::unique_ptr<Socket, PMRDeleter<Socket>> socket(std::move(socketImpl));
+
+        HTTPServer::Config config;
+        config.connectionModel = options.model;
+        config.ioUringSqPoll = options.sqPoll;
+        config.shardListeners = options.shardListeners;
+        config.workerCount = options.workers;
+        HTTPServer server(std::move(socket), memoryManager, config);
+
+        server.registerHandler(std::pmr::string("/", resource),
+            [](const HTTPServer::Request& req) -> HTTPServer::Response {
+                auto* reqResource = req.method.get_allocator().resource();
+                HTTPServer::Response res(200, {}, reqResource);
+                res.body = std::pmr::vector<uint8_t>({ 'O', 'K' }, reqResource);
+                return res;
+            });
+
+        server.registerHandler(std::pmr::string("/echo", resource),
+            [](const HTTPServer::Request& req) -> HTTPServer::Response {
+                auto* reqResource = req.method.get_allocator().resource();
+                HTTPServer::Response res(200, {}, reqResource);
+                res.body = std::pmr::vector<uint8_t>(req.body.begin(), req.body.end(), reqResource);
+                return res;
+            });
+
+        std::pmr::string address("127.0.0.1", resource);
+        auto startResult = server.start(address, options.port);
+        if (startResult.type != SocketError::Type::None) {
+            std::cerr << "Failed to start server: " << startResult.internalCode << std::endl;
+            return false;
+        }
+
+        size_t connections = std::max<size_t>(options.connections, 1);
+        size_t depth = options.keepAlive ? std::max<size_t>(options.pipelineDepth, 1) : 1;
+        auto path = std::pmr::string(options.bodySize == 0 ? "/" : "/echo", resource);
+        auto request = makeRequest(path, options.bodySize, options.keepAlive, resource);
+
+        std::vector<std::unique_ptr<ConnectionLoad>> loads;
+        for (size_t i = 0; i < connections; ++i) {
+            auto load = std::make_unique<ConnectionLoad>(resource);
+            if (options.keepAlive && !load->client.connect(address, options.port)) {
+                std::cerr << "Failed to open connection " << i << std::endl;
+                return false;
+            }
+            loads.push_back(std::move(load));
+        }
+
+        Window window;
+        window.interval = Clock::duration::zero();
+        if (options.rate > 0.0) {
+            window.interval = std::chrono::duration_cast<Clock::duration>(
+                std::chrono::duration<double>(static_cast<double>(connections) / options.rate));
+        }
+        window.start = Clock::now() + std::chrono::milliseconds(10);
+        window.measureFrom = window.start + options.warmup;
+        window.end = window.measureFrom + options.duration;
+
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < connections; ++i) {
+            ConnectionLoad& load = *loads[i];
+
+            // Connections Start Staggered Across One Interval, Not in Lockstep
+            Clock::time_point first = window.start + window.interval * i / connections;
+
+            if (!options.keepAlive) {
+                threads.emplace_back(connectPerRequestLoop, std::ref(load), std::cref(window), std::cref(address),
+                    options.port, std::cref(request), first);
+                continue;
+            }
+            threads.emplace_back(sendLoop, std::ref(load), std::cref(window), std::cref(request), depth, first);
+            threads.emplace_back(receiveLoop, std::ref(load), std::cref(window));
+        }
+        // Process CPU Across the Measured Window; the Client Side is the Same
+        // for Every Model, so Differences Between Runs are the Server's
+        std::this_thread::sleep_until(window.measureFrom);
+        auto cpuBefore = processCpuTime();
+        std::this_thread::sleep_until(window.end);
+        auto cpuSpent = processCpuTime() - cpuBefore;
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        LatencyHistogram histogram;
+        result.requests = 0;
+        result.errors = 0;
+        for (auto& load : loads) {
+            histogram.merge(load->histogram);
+            result.requests += load->completed;
+            result.errors += load->errors;
+            load->client.close();
+        }
+
+        auto measured = std::chrono::duration<double>(window.end - window.measureFrom);
+        result.requestsPerSecond = static_cast<double>(result.requests) / measured.count();
+        result.p50 = std::chrono::nanoseconds(histogram.valueAtPercentile(50.0));
+        result.p99 = std::chrono::nanoseconds(histogram.valueAtPercentile(99.0));
+        result.p999 = std::chrono::nanoseconds(histogram.valueAtPercentile(99.9));
+        result.max = std::chrono::nanoseconds(histogram.max());
+        result.cpuPerRequest = std::chrono::nanoseconds(0);
+        if (result.requests > 0) {
+            result.cpuPerRequest = std::chrono::duration_cast<std::chrono::nanoseconds>(cpuSpent)
+                / static_cast<int64_t>(result.requests);
+        }
+
+        server.stop();
+        return true;
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "HTTPServer.h"
+#include <chrono>
+#include <cstdint>
+
+namespace Bench {
+    struct LoadOptions {
+        ConnectionModel model = ConnectionModel::EventLoop;
+        size_t connections = 16;
+        std::chrono::seconds duration{ 5 };     // Measured Window
+        std::chrono::seconds warmup{ 1 };       // Run Before the Window, Not Recorded
+        double rate = 0.0;                      // Requests/s Over All Connections; 0 = Closed Loop
+        size_t pipelineDepth = 1;               // Requests Outstanding per Connection
+        bool keepAlive = true;                  // Off: One Connection per Request
+        size_t bodySize = 0;                    // Echoed POST Body; 0 = GET
+        bool sqPoll = false;                    // io_uring Model: Kernel-Side Submission Polling
+        bool shardListeners = false;            // Loop Models: SO_REUSEPORT Listener per Loop
+        size_t workers = 0;                     // Loop Models: Handler Threads; 0 = Inline
+        uint16_t port = 18081;
+    };
+
+    struct LoadResult {
+        uint64_t requests;                      // Completed Inside the Window
+        uint64_t errors;
+        double requestsPerSecond;
+        std::chrono::nanoseconds p50;
+        std::chrono::nanoseconds p99;
+        std::chrono::nanoseconds p999;
+        std::chrono::nanoseconds max;
+        std::chrono::nanoseconds cpuPerRequest; // Whole Process (Clients Too) Over the Window
+    };
+
+    // Drives an In-Process HTTPServer Over Loopback From One Sender and One
+    // Receiver Thread per Connection. Closed Loop Keeps pipelineDepth Requests
+    // Outstanding; Open Loop Sends on a Fixed Schedule and Measures Latency
+    // From Each Request's Scheduled Time, so a Stalled Server is Charged for
+    // the Requests That Queued Behind the Stall (No Coordinated Omission)
+    bool runLoad(const LoadOptions& options, LoadResult& result);
+}
@@ -0,0 +1,108 @@
+#include "RouterBench.h"
+#include "Router.h"
+#include <chrono>
+#include <functional>
+#include <optional>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <iostream>
+
+namespace Bench {
+    namespace {
+        // Mirrors the Shape of HTTPServer::RouteConfig Before the Radix Router
+        struct LinearRoute {
+            std::pmr::string path;
+            std::vector<std::pmr::string> allowedMethods;
+            std::function<size_t(std::string_view)> handler;
+        };
+
+        bool isMethodAllowed(const std::vector<std::pmr::string>& allowed, const std::pmr::string& method) {
+            if (allowed.empty()) return true;
+            for (const auto& candidate : allowed) {
+                if (candidate == method) return true;
+            }
+            return false;
+        }
+
+        std::optional<LinearRoute> findLinear(const std::vector<LinearRoute>& routes,
+            const std::pmr::string& path, const std::pmr::string& method) {
+            for (const auto& route : routes) {
+                if (route.path == path && isMethodAllowed(route.allowedMethods, method)) {
+                    return route;
+                }
+            }
+            return std::nullopt;
+        }
+
+        // REST-Style Table: Shared Prefixes, a Few Distinct Services, Varying Depth
+        std::vector<std::string> makePaths(size_t count) {
+            constexpr std::string_view Services[] = { "users", "orders", "billing", "inventory", "search" };
+            std::vector<std::string> paths;
+            for (size_t i = 0; i < count; ++i) {
+                std::string path = "/api/v1/";
+                path += Services[i % std::size(Services)];
+                path += "/resource";
+                path += std::to_string(i);
+                if (i % 3 == 0) path += "/details";
+                paths.push_back(std::move(path));
+            }
+            return paths;
+        }
+
+        template <typename Fn>
+        double nanosecondsPerLookup(size_t lookups, const std::vector<std::string>& paths, Fn&& fn) {
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < lookups; ++i) {
+                fn(paths[i % paths.size()]);
+            }
+            auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+            return elapsed.count() / static_cast<double>(lookups);
+        }
+    }
+
+    bool runRouter(const RouterOptions& options, std::vector<RouterResult>& results) {
+        volatile size_t sink = 0;
+
+        for (size_t count : { size_t(10), size_t(100), size_t(1000) }) {
+            auto paths = makePaths(count);
+
+            std::vector<LinearRoute> linear;
+            Router router;
+            for (size_t i = 0; i < paths.size(); ++i) {
+                linear.push_back(LinearRoute{ std::pmr::string(paths[i]), { "GET", "POST" },
+                    [](std::string_view body) { return body.size(); } });
+                if (!router.add(paths[i], HttpMethod::Get | HttpMethod::Post, static_cast<uint32_t>(i))) {
+                    std::cerr << "Router rejected " << paths[i] << std::endl;
+                    return false;
+                }
+            }
+
+            bool matched = true;
+            RouterResult result{};
+            result.routes = count;
+
+            // The Old Server Built pmr::strings for Path and Method per Request Too
+            const std::pmr::string method("POST");
+            result.linearNsPerLookup = nanosecondsPerLookup(options.lookups, paths, [&](const std::string& path) {
+                auto route = findLinear(linear, std::pmr::string(path), method);
+                matched = matched && route.has_value();
+                sink = sink + (route ? route->path.size() : 0);
+            });
+
+            result.radixNsPerLookup = nanosecondsPerLookup(options.lookups, paths, [&](const std::string& path) {
+                auto match = router.find(path, HttpMethod::fromName("POST"));
+                matched = matched && match.found;
+                sink = sink + match.routeId;
+            });
+            result.radixNodes = router.getNodeCount();
+
+            if (!matched) {
+                std::cerr << "Lookup missed a registered route at " << count << " routes" << std::endl;
+                return false;
+            }
+            results.push_back(result);
+        }
+        return true;
+    }
+}
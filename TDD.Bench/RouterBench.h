@@ -0,0 +1,20 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+namespace Bench {
+    struct RouterOptions {
+        size_t lookups = 1000000;       // Lookups per Table Size
+    };
+
+    struct RouterResult {
+        size_t routes;
+        double linearNsPerLookup;       // Previous Full-String Scan Returning a RouteConfig Copy
+        double radixNsPerLookup;        // Router::find
+        size_t radixNodes;
+    };
+
+    // Looks up Every Registered Path Round-Robin at 10, 100 and 1000 Routes
+    bool runRouter(const RouterOptions& options, std::vector<RouterResult>& results);
+}
@@ -0,0 +1,225 @@
+#include "IdleLatencyBench.h"
+#include "HeaderScanBench.h"
+#include "RouterBench.h"
+#include "LoadBench.h"
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <cstdlib>
+
+namespace {
+    void printUsage() {
+        std::cout << "Usage: Bench idle [--model thread|loop|uring] [--connections N]\n"
+            << "                  [--idle-seconds S] [--requests R] [--port P]\n"
+            << "       Bench scan [--iterations N]\n"
+            << "       Bench route [--lookups N]\n"
+            << "       Bench load [--model thread|loop|uring] [--connections N] [--seconds S]\n"
+            << "                  [--warmup S] [--rate R] [--pipeline D] [--keep-alive 0|1]\n"
+            << "                  [--body B] [--sqpoll 0|1] [--shard 0|1] [--workers N]\n"
+            << "                  [--port P]" << std::endl;
+    }
+
+    ConnectionModel parseModel(std::string_view value) {
+        if (value == "loop") return ConnectionModel::EventLoop;
+        if (value == "uring") return ConnectionModel::IoUring;
+        return ConnectionModel::ThreadPerSession;
+    }
+
+    double toMicros(std::chrono::nanoseconds value) {
+        return static_cast<double>(value.count()) / 1000.0;
+    }
+
+    int runIdle(int argc, char** argv) {
+        Bench::IdleLatencyOptions options;
+        for (int i = 2; i + 1 < argc; i += 2) {
+            std::string_view flag(argv[i]);
+            std::string_view value(argv[i + 1]);
+            if (flag == "--model") {
+                options.model = parseModel(value);
+            }
+            else if (flag == "--connections") {
+                options.connections = std::strtoull(argv[i + 1], nullptr, 10);
+            }
+            else if (flag == "--idle-seconds") {
+                options.idleWindow = std::chrono::seconds(std::strtoll(argv[i + 1], nullptr, 10));
+            }
+            else if (flag == "--requests") {
+                options.requestsPerConnection = std::strtoull(argv[i + 1], nullptr, 10);
+            }
+            else if (flag == "--port") {
+                options.port = static_cast<uint16_t>(std::strtoul(argv[i + 1], nullptr, 10));
+            }
+            else {
+                printUsage();
+                return 1;
+            }
+        }
+
+        Bench::IdleLatencyResult result{};
+        if (!Bench::runIdleLatency(options, result)) {
+            return 1;
+        }
+
+        std::cout << "connections:   " << options.connections << "\n"
+            << "idle cpu:      " << result.idleCpuPercent << " %\n"
+            << "throughput:    " << result.requestsPerSecond << " req/s\n"
+            << "latency p50:   " << toMicros(result.p50) << " us\n"
+            << "latency p99:   " << toMicros(result.p99) << " us\n"
+            << "latency max:   " << toMicros(result.max) << " us" << std::endl;
+        return 0;
+    }
+
+    int runScan(int argc, char** argv) {
+        Bench::HeaderScanOptions options;
+        for (int i = 2; i + 1 < argc; i += 2) {
+            std::string_view flag(argv[i]);
+            if (flag == "--iterations") {
+                options.iterations = std::strtoull(argv[i + 1], nullptr, 10);
+            }
+            else {
+                printUsage();
+                return 1;
+            }
+        }
+
+        std::vector<Bench::HeaderScanResult> results;
+        if (!Bench::runHeaderScan(options, results)) {
+            return 1;
+        }
+
+        std::cout << "kernel    scan ns/req   parse ns/req   parse MB/s" << std::endl;
+        for (const auto& result : results) {
+            std::cout << std::left << std::setw(10) << ByteScanner::kernelName(result.kernel)
+                << std::right << std::setw(11) << result.scanNsPerRequest
+                << std::setw(15) << result.parseNsPerRequest
+                << std::setw(13) << result.parseMegabytesPerSecond << std::endl;
+        }
+        return 0;
+    }
+
+    int runRoute(int argc, char** argv) {
+        Bench::RouterOptions options;
+        for (int i = 2; i + 1 < argc; i += 2) {
+            std::string_view flag(argv[i]);
+            if (flag == "--lookups") {
+                options.lookups = std::strtoull(argv[i + 1], nullptr, 10);
+            }
+            else {
+                printUsage();
+                return 1;
+            }
+        }
+
+        std::vector<Bench::RouterResult> results;
+        if (!Bench::runRouter(options, results)) {
+            return 1;
+        }
+
+        std::cout << "routes   linear ns/lookup   radix ns/lookup   radix nodes" << std::endl;
+        for (const auto& result : results) {
+            std::cout << std::left << std::setw(9) << result.routes
+                << std::right << std::setw(16) << result.linearNsPerLookup
+                << std::setw(18) << result.radixNsPerLookup
+                << std::setw(14) << result.radixNodes << std::endl;
+        }
+        return 0;
+    }
+
+    int runLoad(int argc, char** argv) {
+        Bench::LoadOptions options;
+        for (int i = 2; i + 1 < argc; i += 2) {
+            std::string_view flag(argv[i]);
+            std::string_view value(argv[i + 1]);
+            if (flag == "--model") {
+                options.model = parseModel(value);
+            }
+            else if (flag == "--connections") {
+                options.connections = std::strtoull(argv[i + 1], nullptr, 10);
+            }
+            else if (flag == "--seconds") {
+                options.duration = std::chrono::seconds(std::strtoll(argv[i + 1], nullptr, 10));
+            }
+            else if (flag == "--warmup") {
+                options.warmup = std::chrono::seconds(std::strtoll(argv[i + 1], nullptr, 10));
+            }
+            else if (flag == "--rate") {
+                options.rate = std::strtod(argv[i + 1], nullptr);
+            }
+            else if (flag == "--pipeline") {
+                options.pipelineDepth = std::strtoull(argv[i + 1], nullptr, 10);
+            }
+            else if (flag == "--keep-alive") {
+                options.keepAlive = value != "0";
+            }
+            else if (flag == "--body") {
+                options.bodySize = std::strtoull(argv[i + 1], nullptr, 10);
+            }
+            else if (flag == "--sqpoll") {
+                options.sqPoll = value != "0";
+            }
+            else if (flag == "--shard") {
+                options.shardListeners = value != "0";
+            }
+            else if (flag == "--workers") {
+                options.workers = std::strtoull(argv[i + 1], nullptr, 10);
+            }
+            else if (flag == "--port") {
+                options.port = static_cast<uint16_t>(std::strtoul(argv[i + 1], nullptr, 10));
+            }
+            else {
+                printUsage();
+                return 1;
+            }
+        }
+
+        Bench::LoadResult result{};
+        if (!Bench::runLoad(options, result)) {
+            return 1;
+        }
+
+        std::cout << "load:          ";
+        if (options.rate > 0.0) {
+            std::cout << "open loop, " << options.rate << " req/s offered\n";
+        }
+        else {
+            std::cout << "closed loop\n";
+        }
+        std::cout << "connections:   " << options.connections
+            << (options.keepAlive ? ", keep-alive" : ", connection per request")
+            << ", pipeline " << options.pipelineDepth << ", body " << options.bodySize << " B\n"
+            << "requests:      " << result.requests << " (" << result.errors << " errors)\n"
+            << "throughput:    " << result.requestsPerSecond << " req/s\n"
+            << "latency p50:   " << toMicros(result.p50) << " us\n"
+            << "latency p99:   " << toMicros(result.p99) << " us\n"
+            << "latency p99.9: " << toMicros(result.p999) << " us\n"
+            << "latency max:   " << toMicros(result.max) << " us\n"
+            << "cpu/request:   " << toMicros(result.cpuPerRequest) << " us" << std::endl;
+        return 0;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        printUsage();
+        return 1;
+    }
+
+    std::string_view mode(argv[1]);
+    if (mode == "idle") {
+        return runIdle(argc, argv);
+    }
+    if (mode == "scan") {
+        return runScan(argc, argv);
+    }
+    if (mode == "route") {
+        return runRoute(argc, argv);
+    }
+    if (mode == "load") {
+        return runLoad(argc, argv);
+    }
+
+    printUsage();
+    return 1;
+}
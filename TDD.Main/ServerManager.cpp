@@ -1,5 +1,9 @@
 #include "ServerManager.h"
+#ifdef _WIN32
 #include "WinsockSocket.h"
+#else
+#include "PosixSocket.h"
+#endif
 #include "PMRDeleter.h"
 #include <iostream>
 #include <format>
@@ -10,20 +14,26 @@ ServerManager::ServerManager(std::shared_ptr<BumpMemoryManager> memoryManager)
     server_(nullptr, PMRDeleter<HTTPServer>(resource_))
 {
     // Create Socket
+#ifdef _WIN32
     auto socketImpl = make_pmr_unique_ptr<WinsockSocket>(resource_, resource_);
+#else
+    auto socketImpl = make_pmr_unique_ptr<PosixSocket>(resource_, resource_);
+#endif
+
+    // Create a unique_ptr<Socket> from the Platform Socket
+    std::unique_ptr<Socket, PMRDeleter<Socket>> socket(std::move(socketImpl));
 
-    // Create a unique_ptr<Socket> from unique_ptr<WinsockSocket>
-    std::unique_ptr<Socket, PMRDeleter<Socket>> socket(
-        socketImpl.release(),
-        PMRDeleter<Socket>(resource_)
-    );
 
+    // Reactor per Core (Falls Back to Thread-per-Session Without an I/O Engine)
+    HTTPServer::Config config;
+    config.connectionModel = ConnectionModel::EventLoop;
 
     // Create Server
     server_ = make_pmr_unique_ptr<HTTPServer>(
         resource_,
         std::move(socket),
-        memoryManager_
+        memoryManager_,
+        config
     );
 }
 
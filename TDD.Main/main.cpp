@@ -13,7 +13,13 @@ int main() {
 
         // Initialize Memory Management
         constexpr size_t BUFFER_SIZE = 1000 * 1024 * 1024; // 1000MB
-        auto memoryManager = std::make_shared<BumpMemoryManager>(BUFFER_SIZE);
+
+        // Recycled Session Arenas: Connection Churn Reuses Resident Memory
+        SessionArenaPool::Config sessionArenas;
+        sessionArenas.arenaCount = 64;
+        sessionArenas.arenaSize = 1000 * 1024;      // HTTPServer's Default Session Buffer
+        sessionArenas.hugePages = true;
+        auto memoryManager = std::make_shared<BumpMemoryManager>(BUFFER_SIZE, sessionArenas);
 
         // Get Server's Resource for Initial Allocations
         auto* resource = memoryManager->getResource();
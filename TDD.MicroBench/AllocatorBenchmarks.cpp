@@ -0,0 +1,88 @@
+#include "HTTPServerAccess.h"
+#include "CountingResource.h"
+#include "ThreadCachingResource.h"
+#include <benchmark/benchmark.h>
+#include <string_view>
+
+namespace {
+    constexpr std::string_view Request =
+        "POST /rpc/Calculator.Add HTTP/1.1\r\n"
+        "Host: rpc.internal:8070\r\n"
+        "Content-Type: application/json\r\n"
+        "Content-Length: 18\r\n"
+        "X-Request-Id: 7d3c9b0e-4a1f-4e8b-9c2d-6f5a3b1e0d7c\r\n"
+        "\r\n"
+        "{\"a\": 40, \"b\": 2}\n";
+
+    // Session Setup and Teardown: Buffer, Monotonic Arena and Pool
+    void BM_CreateClientResource(benchmark::State& state) {
+        BumpMemoryManager memoryManager(1024 * 1024);
+        size_t size = static_cast<size_t>(state.range(0));
+        bool synchronizedPool = state.range(1) != 0;
+
+        for (auto _ : state) {
+            auto resource = memoryManager.createClientResource(size, synchronizedPool);
+            benchmark::DoNotOptimize(resource.get());
+        }
+    }
+
+    // The Same Churn Through Recycled, Already Faulted Session Arenas
+    void BM_CreatePooledClientResource(benchmark::State& state) {
+        SessionArenaPool::Config sessionArenas;
+        sessionArenas.arenaCount = 4;
+        sessionArenas.arenaSize = static_cast<size_t>(state.range(0));
+        BumpMemoryManager memoryManager(1024 * 1024, sessionArenas);
+        bool synchronizedPool = state.range(1) != 0;
+
+        for (auto _ : state) {
+            auto resource = memoryManager.createClientResource(sessionArenas.arenaSize, synchronizedPool);
+            benchmark::DoNotOptimize(resource.get());
+        }
+    }
+
+    // Server-Wide Resource Under Threads: Short-Lived Mixed-Size Blocks
+    template<typename Resource>
+    void BM_SharedResource(benchmark::State& state) {
+        static Resource resource;
+        constexpr size_t Sizes[] = { 24, 64, 200, 1024, 4096, 16 * 1024 };
+        void* blocks[std::size(Sizes)];
+
+        for (auto _ : state) {
+            for (size_t i = 0; i < std::size(Sizes); ++i) {
+                blocks[i] = resource.allocate(Sizes[i], 8);
+            }
+            for (size_t i = 0; i < std::size(Sizes); ++i) {
+                resource.deallocate(blocks[i], Sizes[i], 8);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * std::size(Sizes));
+    }
+
+    // One Request's Allocations Through a Session Arena, Against the Global Heap
+    void BM_RequestAllocations(benchmark::State& state) {
+        MicroBench::IdleServer idle;
+        std::pmr::vector<uint8_t> data(Request.begin(), Request.end());
+        bool arena = state.range(0) != 0;
+
+        auto clientResource = idle.memoryManager->createClientResource();
+        CountingResource counting(arena ? clientResource.get() : std::pmr::new_delete_resource());
+
+        for (auto _ : state) {
+            auto request = HTTPServerAccess::parseRequest(*idle.server, data, &counting);
+            auto response = HTTPServer::Response(200, {}, &counting);
+            response.body.assign(request.body.begin(), request.body.end());
+            benchmark::DoNotOptimize(HTTPServerAccess::serializeResponse(*idle.server, std::move(response), &counting, true));
+        }
+
+        auto counts = counting.counts();
+        state.counters["allocs"] = benchmark::Counter(static_cast<double>(counts.allocations), benchmark::Counter::kAvgIterations);
+        state.counters["alloc_bytes"] = benchmark::Counter(static_cast<double>(counts.bytesAllocated), benchmark::Counter::kAvgIterations);
+        state.SetLabel(arena ? "session arena" : "new/delete");
+    }
+}
+
+BENCHMARK(BM_CreateClientResource)->ArgsProduct({ { 64 * 1024, 256 * 1024, 1000 * 1024 }, { 0, 1 } })->ArgNames({ "bytes", "sync" });
+BENCHMARK(BM_CreatePooledClientResource)->ArgsProduct({ { 64 * 1024, 256 * 1024, 1000 * 1024 }, { 0, 1 } })->ArgNames({ "bytes", "sync" });
+BENCHMARK(BM_SharedResource<std::pmr::synchronized_pool_resource>)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_SharedResource<ThreadCachingResource>)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_RequestAllocations)->Arg(0)->Arg(1);
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "HTTPServer.h"
+#include "BumpMemoryManager.h"
+#include "PMRDeleter.h"
+#ifdef _WIN32
+#include "WinsockSocket.h"
+#else
+#include "PosixSocket.h"
+#endif
+#include <memory>
+#include <memory_resource>
+#include <string_view>
+
+// Reaches the Private Request Stages of an HTTPServer That is Never Started
+struct HTTPServerAccess {
+    static HTTPServer::Request parseRequest(HTTPServer& server, const std::pmr::vector<uint8_t>& data, std::pmr::memory_resource* resource) {
+        return server.parseRequest(data, resource);
+    }
+
+    static size_t serializeResponse(HTTPServer& server, HTTPServer::Response&& response, std::pmr::memory_resource* resource, bool keepAlive) {
+        return server.serializeResponse(std::move(response), resource, keepAlive).size();
+    }
+
+    // Against the Current Route Snapshot; Safe Only While Nothing Registers Concurrently
+    static bool findMatchingRoute(const HTTPServer& server, std::string_view path, std::string_view method, Router::Match& match) {
+        return server.findMatchingRoute(*server.routeTable_.load(), path, method, match) != nullptr;
+    }
+};
+
+namespace MicroBench {
+#ifdef _WIN32
+    using PlatformSocket = WinsockSocket;
+#else
+    using PlatformSocket = PosixSocket;
+#endif
+
+    // Server Whose Socket is Never Initialized; Only its Routes and Stages are Used
+    struct IdleServer {
+        std::shared_ptr<BumpMemoryManager> memoryManager;
+        std::unique_ptr<HTTPServer> server;
+
+        IdleServer()
+            : memoryManager(std::make_shared<BumpMemoryManager>(16 * 1024 * 1024)) {
+            auto* resource = memoryManager->getResource();
+            auto socketImpl = make_pmr_unique_ptr<PlatformSocket>(resource, resource);
+            std::unique_ptr<Socket, PMRDeleter<Socket>> socket(std::move(socketImpl));
+            server = std::make_unique<HTTPServer>(std::move(socket), memoryManager);
+        }
+    };
+}
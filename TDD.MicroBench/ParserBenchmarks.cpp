@@ -0,0 +1,77 @@
+#include "HTTPServerAccess.h"
+#include "CountingResource.h"
+#include <benchmark/benchmark.h>
+#include <string_view>
+
+namespace {
+    constexpr std::string_view Requests[] = {
+        "GET /api/data HTTP/1.1\r\n"
+        "Host: 127.0.0.1:8070\r\n"
+        "User-Agent: curl/8.5.0\r\n"
+        "Accept: */*\r\n"
+        "\r\n",
+
+        "GET /api/data?page=2&limit=50 HTTP/1.1\r\n"
+        "Host: api.example.com\r\n"
+        "Connection: keep-alive\r\n"
+        "User-Agent: Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/124.0.0.0 Safari/537.36\r\n"
+        "Accept: application/json, text/plain, */*\r\n"
+        "Sec-Fetch-Site: same-origin\r\n"
+        "Sec-Fetch-Mode: cors\r\n"
+        "Sec-Fetch-Dest: empty\r\n"
+        "Referer: https://api.example.com/dashboard\r\n"
+        "Accept-Encoding: gzip, deflate, br, zstd\r\n"
+        "Accept-Language: en-US,en;q=0.9\r\n"
+        "Cookie: session=5f2b8c1e9a4d7f3b6e0c2a8d1f4b7e9c; theme=dark\r\n"
+        "\r\n",
+
+        "POST /rpc/Calculator.Add HTTP/1.1\r\n"
+        "Host: rpc.internal:8070\r\n"
+        "Content-Type: application/json\r\n"
+        "Content-Length: 18\r\n"
+        "X-Request-Id: 7d3c9b0e-4a1f-4e8b-9c2d-6f5a3b1e0d7c\r\n"
+        "\r\n"
+        "{\"a\": 40, \"b\": 2}\n",
+    };
+
+    constexpr const char* RequestNames[] = { "curl", "browser", "post" };
+
+    // Owned Request (Strings, Header Map, Body) Built in a Session-Style Pool
+    void BM_ParseRequest(benchmark::State& state) {
+        MicroBench::IdleServer idle;
+        auto text = Requests[state.range(0)];
+        std::pmr::vector<uint8_t> data(text.begin(), text.end());
+
+        std::pmr::unsynchronized_pool_resource pool;
+        CountingResource counting(&pool);
+
+        for (auto _ : state) {
+            auto request = HTTPServerAccess::parseRequest(*idle.server, data, &counting);
+            benchmark::DoNotOptimize(request.headers.size());
+        }
+
+        auto counts = counting.counts();
+        state.counters["allocs"] = benchmark::Counter(static_cast<double>(counts.allocations), benchmark::Counter::kAvgIterations);
+        state.counters["alloc_bytes"] = benchmark::Counter(static_cast<double>(counts.bytesAllocated), benchmark::Counter::kAvgIterations);
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size()));
+        state.SetLabel(RequestNames[state.range(0)]);
+    }
+
+    // Zero-Copy View Alone, for Comparison
+    void BM_ParseRequestView(benchmark::State& state) {
+        auto text = Requests[state.range(0)];
+        auto data = std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(text.data()), text.size());
+
+        RequestParser parser;
+        for (auto _ : state) {
+            parser.reset();
+            benchmark::DoNotOptimize(parser.parse(data));
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size()));
+        state.SetLabel(RequestNames[state.range(0)]);
+    }
+}
+
+BENCHMARK(BM_ParseRequest)->DenseRange(0, 2);
+BENCHMARK(BM_ParseRequestView)->DenseRange(0, 2);
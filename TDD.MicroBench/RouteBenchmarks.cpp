@@ -0,0 +1,60 @@
+#include "HTTPServerAccess.h"
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+namespace {
+    // REST-Style Table (as in the Bench Route Comparison) Plus One Parameterized Route per Service
+    std::vector<std::string> registerRoutes(HTTPServer& server, size_t count, std::pmr::memory_resource* resource) {
+        constexpr std::string_view Services[] = { "users", "orders", "billing", "inventory", "search" };
+        auto handler = [](const HTTPServer::Request& request) {
+            return HTTPServer::Response(200, {}, request.method.get_allocator().resource());
+        };
+
+        std::vector<std::string> paths;
+        for (size_t i = 0; i < count; ++i) {
+            std::string path = "/api/v1/";
+            path += Services[i % std::size(Services)];
+            path += "/resource";
+            path += std::to_string(i);
+            if (i % 3 == 0) path += "/details";
+            server.registerHandler(std::pmr::string(path, resource), handler);
+            paths.push_back(std::move(path));
+        }
+
+        for (auto service : Services) {
+            std::string pattern = "/api/v2/";
+            pattern += service;
+            pattern += "/{id}";
+            server.registerHandler(std::pmr::string(pattern, resource), handler);
+        }
+        return paths;
+    }
+
+    void BM_FindMatchingRoute(benchmark::State& state) {
+        MicroBench::IdleServer idle;
+        auto paths = registerRoutes(*idle.server, static_cast<size_t>(state.range(0)), idle.memoryManager->getResource());
+
+        size_t next = 0;
+        Router::Match match;
+        for (auto _ : state) {
+            bool found = HTTPServerAccess::findMatchingRoute(*idle.server, paths[next], "GET", match);
+            benchmark::DoNotOptimize(found);
+            next = next + 1 == paths.size() ? 0 : next + 1;
+        }
+    }
+
+    void BM_FindMatchingRouteParam(benchmark::State& state) {
+        MicroBench::IdleServer idle;
+        registerRoutes(*idle.server, static_cast<size_t>(state.range(0)), idle.memoryManager->getResource());
+
+        Router::Match match;
+        for (auto _ : state) {
+            bool found = HTTPServerAccess::findMatchingRoute(*idle.server, "/api/v2/orders/8812?expand=items", "GET", match);
+            benchmark::DoNotOptimize(found);
+        }
+    }
+}
+
+BENCHMARK(BM_FindMatchingRoute)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BM_FindMatchingRouteParam)->Arg(10)->Arg(1000);
@@ -0,0 +1,43 @@
+#include "HTTPServerAccess.h"
+#include "CountingResource.h"
+#include <benchmark/benchmark.h>
+
+namespace {
+    // Handler-Style Response: Content-Type, One Custom Header and a Filler Body
+    HTTPServer::Response makeResponse(size_t bodySize, std::pmr::memory_resource* resource) {
+        HTTPServer::Response response(200, {}, resource);
+        response.headers.emplace(std::pmr::string("Content-Type", resource), std::pmr::string("application/json", resource));
+        response.headers.emplace(std::pmr::string("X-Request-Id", resource), std::pmr::string("7d3c9b0e-4a1f-4e8b", resource));
+        response.body.assign(bodySize, uint8_t('x'));
+        return response;
+    }
+
+    // Building the Response Alone; Subtract From BM_SerializeResponse
+    void BM_BuildResponse(benchmark::State& state) {
+        std::pmr::unsynchronized_pool_resource pool;
+        for (auto _ : state) {
+            auto response = makeResponse(static_cast<size_t>(state.range(0)), &pool);
+            benchmark::DoNotOptimize(response.body.data());
+        }
+    }
+
+    // Counts Only What Serialization Allocates: the Response Comes From the Uncounted Pool
+    void BM_SerializeResponse(benchmark::State& state) {
+        MicroBench::IdleServer idle;
+        std::pmr::unsynchronized_pool_resource pool;
+        CountingResource counting(&pool);
+        bool keepAlive = state.range(1) != 0;
+
+        for (auto _ : state) {
+            auto response = makeResponse(static_cast<size_t>(state.range(0)), &pool);
+            benchmark::DoNotOptimize(HTTPServerAccess::serializeResponse(*idle.server, std::move(response), &counting, keepAlive));
+        }
+
+        auto counts = counting.counts();
+        state.counters["allocs"] = benchmark::Counter(static_cast<double>(counts.allocations), benchmark::Counter::kAvgIterations);
+        state.counters["alloc_bytes"] = benchmark::Counter(static_cast<double>(counts.bytesAllocated), benchmark::Counter::kAvgIterations);
+    }
+}
+
+BENCHMARK(BM_BuildResponse)->Arg(0)->Arg(2048);
+BENCHMARK(BM_SerializeResponse)->ArgsProduct({ { 0, 2048 }, { 0, 1 } })->ArgNames({ "body", "keepalive" });
@@ -0,0 +1,4 @@
+#include <benchmark/benchmark.h>
+
+// Filter With --benchmark_filter=<regex>; allocs/alloc_bytes Counters are per Iteration
+BENCHMARK_MAIN();
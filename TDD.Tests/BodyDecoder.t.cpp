@@ -0,0 +1,106 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "BodyDecoder.h"
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace BodyDecoderTests {
+    struct Decoded {
+        BodyDecoder::Status status;
+        std::string body;
+        size_t consumed = 0;
+    };
+
+    // Feeds input in Pieces of step Bytes, Keeping Unconsumed Bytes Like a Receive Buffer
+    Decoded decodeAll(BodyDecoder& decoder, std::string_view input, size_t step) {
+        Decoded result{ BodyDecoder::Status::Incomplete, {}, 0 };
+        std::vector<uint8_t> buffer;
+        size_t fed = 0;
+
+        while (true) {
+            std::span<const uint8_t> data;
+            size_t used = 0;
+            auto status = decoder.decode(buffer, data, used);
+            if (status == BodyDecoder::Status::Data) {
+                result.body.append(reinterpret_cast<const char*>(data.data()), data.size());
+            }
+
+            // data Points Into buffer; Only Drop Bytes Once it Was Copied
+            buffer.erase(buffer.begin(), buffer.begin() + used);
+            result.consumed += used;
+            if (status == BodyDecoder::Status::Data) {
+                continue;
+            }
+            if (status == BodyDecoder::Status::Incomplete && fed < input.size()) {
+                size_t take = std::min(step, input.size() - fed);
+                buffer.insert(buffer.end(), input.begin() + fed, input.begin() + fed + take);
+                fed += take;
+                continue;
+            }
+            result.status = status;
+            return result;
+        }
+    }
+
+    TEST(BodyDecoder, PassesContentLengthBodyThrough) {
+        BodyDecoder decoder;
+        decoder.resetLength(5);
+
+        auto result = decodeAll(decoder, "helloGET / HTTP/1.1", 2);
+        EXPECT_EQ(result.status, BodyDecoder::Status::Done);
+        EXPECT_EQ(result.body, "hello");
+        EXPECT_EQ(result.consumed, 5u);
+        EXPECT_EQ(decoder.decodedSize(), 5u);
+    }
+
+    TEST(BodyDecoder, DecodesChunkedAtEverySplit) {
+        const std::string_view wire =
+            "5\r\nhello\r\n"
+            "1A;name=value\r\nabcdefghijklmnopqrstuvwxyz\r\n"
+            "0\r\n"
+            "Checksum: abc\r\n"
+            "\r\n"
+            "NEXT";
+
+        for (size_t step = 1; step <= wire.size(); ++step) {
+            BodyDecoder decoder;
+            decoder.resetChunked();
+
+            auto result = decodeAll(decoder, wire, step);
+            ASSERT_EQ(result.status, BodyDecoder::Status::Done) << "step " << step;
+            EXPECT_EQ(result.body, "helloabcdefghijklmnopqrstuvwxyz") << "step " << step;
+            EXPECT_EQ(result.consumed, wire.size() - 4) << "step " << step;
+        }
+    }
+
+    TEST(BodyDecoder, AcceptsBareLineFeeds) {
+        BodyDecoder decoder;
+        decoder.resetChunked();
+
+        auto result = decodeAll(decoder, "3\nabc\n0\n\n", 64);
+        EXPECT_EQ(result.status, BodyDecoder::Status::Done);
+        EXPECT_EQ(result.body, "abc");
+    }
+
+    TEST(BodyDecoder, RejectsMalformedFraming) {
+        for (std::string_view wire : {
+            std::string_view("zz\r\n"),
+            std::string_view("3\r\nabcX\r\n"),
+            std::string_view("1000000000000000\r\n"),
+            std::string_view("3x\r\nabc\r\n") }) {
+            BodyDecoder decoder;
+            decoder.resetChunked();
+            EXPECT_EQ(decodeAll(decoder, wire, 64).status, BodyDecoder::Status::Error) << wire;
+        }
+    }
+
+    TEST(BodyDecoder, RejectsOverlongChunkLine) {
+        BodyDecoder decoder;
+        decoder.resetChunked();
+
+        std::string wire = "5;";
+        wire.append(BodyDecoder::MaxLineBytes, 'x');
+        EXPECT_EQ(decodeAll(decoder, wire, 512).status, BodyDecoder::Status::Error);
+    }
+}
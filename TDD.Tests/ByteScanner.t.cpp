@@ -0,0 +1,78 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "ByteScanner.h"
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ByteScannerTests {
+    std::vector<ByteScanner::Kernel> supportedKernels() {
+        std::vector<ByteScanner::Kernel> kernels;
+        for (auto kernel : { ByteScanner::Kernel::SWAR, ByteScanner::Kernel::SSE42, ByteScanner::Kernel::AVX2 }) {
+            if (ByteScanner::isSupported(kernel)) {
+                kernels.push_back(kernel);
+            }
+        }
+        return kernels;
+    }
+
+    std::vector<size_t> collect(ByteScanner::Kernel kernel, std::string_view text, std::string_view set) {
+        ByteScanner scanner(kernel, text.data(), text.size(), set);
+        std::vector<size_t> positions;
+        for (size_t pos = scanner.next(0); pos < text.size(); pos = scanner.next(pos + 1)) {
+            positions.push_back(pos);
+        }
+        return positions;
+    }
+
+    std::vector<size_t> reference(std::string_view text, std::string_view set) {
+        std::vector<size_t> positions;
+        for (size_t pos = text.find_first_of(set); pos != std::string_view::npos; pos = text.find_first_of(set, pos + 1)) {
+            positions.push_back(pos);
+        }
+        return positions;
+    }
+
+    TEST(ByteScanner, KernelsMatchReferenceAcrossBlockBoundaries) {
+        // Lengths Straddle the 16, 32 and 64 Byte Lanes
+        for (size_t length = 0; length <= 200; ++length) {
+            std::string text;
+            for (size_t i = 0; i < length; ++i) {
+                text.push_back("ab:c d\n\te\r"[(i * 7 + length) % 10]);
+            }
+            auto expected = reference(text, "\n: \t");
+            for (auto kernel : supportedKernels()) {
+                EXPECT_EQ(collect(kernel, text, "\n: \t"), expected)
+                    << ByteScanner::kernelName(kernel) << " length " << length;
+            }
+        }
+    }
+
+    TEST(ByteScanner, SingleDelimiterAtEveryPosition) {
+        for (auto kernel : supportedKernels()) {
+            for (size_t pos = 0; pos < 130; ++pos) {
+                std::string text(130, 'x');
+                text[pos] = '\n';
+                ByteScanner scanner(kernel, text.data(), text.size(), "\n");
+                EXPECT_EQ(scanner.next(0), pos) << ByteScanner::kernelName(kernel);
+                EXPECT_EQ(scanner.next(pos + 1), text.size()) << ByteScanner::kernelName(kernel);
+            }
+        }
+    }
+
+    TEST(ByteScanner, IgnoresBytesPastTheEnd) {
+        const std::string text = "key:value";
+        for (auto kernel : supportedKernels()) {
+            // Delimiter Lives Just Beyond the Scanned Range
+            ByteScanner scanner(kernel, text.data(), 3, ":");
+            EXPECT_EQ(scanner.next(0), 3u) << ByteScanner::kernelName(kernel);
+        }
+    }
+
+    TEST(ByteScanner, SetKernelRejectsUnsupported) {
+        auto original = ByteScanner::activeKernel();
+        EXPECT_TRUE(ByteScanner::setKernel(ByteScanner::Kernel::SWAR));
+        EXPECT_EQ(ByteScanner::activeKernel(), ByteScanner::Kernel::SWAR);
+        EXPECT_TRUE(ByteScanner::setKernel(original));
+    }
+}
@@ -0,0 +1,179 @@
+#include "pch.h"
+
+#ifdef __linux__
+
+#include <gtest/gtest.h>
+#include "Client.h"
+#include "RpcServer.h"
+#include "PosixSocket.h"
+#include <sys/socket.h>
+#include <array>
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <string>
+
+namespace ClientTests {
+    struct Nap {
+        uint32_t ms = 0;
+        uint32_t tag = 0;
+
+        template<class T>
+        void pack(T& pack) {
+            pack(ms, tag);
+        }
+    };
+
+    struct Tag {
+        uint32_t tag = 0;
+
+        template<class T>
+        void pack(T& pack) {
+            pack(tag);
+        }
+    };
+
+    using NapService = RpcService<
+        RpcMethod<"test.nap", [](Nap& request) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(request.ms));
+            return Tag{ request.tag };
+        }>
+    >;
+
+    class ClientTest : public ::testing::Test {
+    protected:
+        static constexpr size_t BlobBytes = 64 * 1024;
+
+        std::shared_ptr<BumpMemoryManager> memoryManager = std::make_shared<BumpMemoryManager>(4 * 1024 * 1024);
+        std::unique_ptr<RpcServer> server;
+        std::pmr::string address{ "127.0.0.1" };
+        uint16_t port = 0;
+
+        void SetUp() override {
+            RpcServer::Config config;
+            config.workerCount = 4;
+
+            // Find a Free Loopback Port
+            for (port = 18270; port < 18370; ++port) {
+                auto* resource = memoryManager->getResource();
+                std::unique_ptr<Socket, PMRDeleter<Socket>> socket(make_pmr_unique_ptr<PosixSocket>(resource, resource));
+                server = std::make_unique<RpcServer>(std::move(socket), memoryManager, config);
+                server->registerService<NapService>();
+                server->registerMethod(rpcMethodId("test.blob"), [](std::span<const uint8_t>, std::pmr::vector<uint8_t>& result) {
+                    result.resize(BlobBytes);
+                    return RpcStatus::Ok;
+                });
+                if (server->start(address, port).type == SocketError::Type::None) {
+                    break;
+                }
+            }
+        }
+
+        void TearDown() override {
+            server->stop();
+        }
+    };
+
+    TEST_F(ClientTest, PipelinedRepliesMatchTheirCalls) {
+        ClientConfig config;
+        config.connectionsPerEndpoint = 2;
+        Client client(std::pmr::get_default_resource(), config);
+
+        // Earlier Calls Sleep Longer, so Replies Come Back Reversed
+        std::vector<std::future<std::expected<Tag, RpcError>>> replies;
+        for (uint32_t i = 0; i < 32; ++i) {
+            Nap request{ (32 - i) % 4, i };
+            replies.push_back(client.callRpc<Nap, Tag>(address, port, "test.nap", request));
+        }
+
+        for (uint32_t i = 0; i < replies.size(); ++i) {
+            auto reply = replies[i].get();
+            ASSERT_TRUE(reply.has_value()) << i;
+            EXPECT_EQ(reply.value().tag, i);
+        }
+        EXPECT_GE(client.getConnectionCount(), 1u);
+        EXPECT_LE(client.getConnectionCount(), 2u);
+    }
+
+    TEST_F(ClientTest, InFlightLimitQueuesCallsOnOneConnection) {
+        ClientConfig config;
+        config.connectionsPerEndpoint = 1;
+        config.maxInFlightPerConnection = 2;
+        Client client(std::pmr::get_default_resource(), config);
+
+        std::vector<std::future<std::expected<Tag, RpcError>>> replies;
+        for (uint32_t i = 0; i < 8; ++i) {
+            Nap request{ 5, i };
+            replies.push_back(client.callRpc<Nap, Tag>(address, port, "test.nap", request));
+        }
+        for (uint32_t i = 0; i < replies.size(); ++i) {
+            auto reply = replies[i].get();
+            ASSERT_TRUE(reply.has_value());
+            EXPECT_EQ(reply.value().tag, i);
+        }
+        EXPECT_EQ(client.getConnectionCount(), 1u);
+    }
+
+    TEST_F(ClientTest, ServerStatusAndUnreachableEndpoint) {
+        Client client;
+
+        Nap request{ 0, 1 };
+        auto unknown = client.callRpc<Nap, Tag>(address, port, "test.missing", request).get();
+        ASSERT_FALSE(unknown.has_value());
+        EXPECT_EQ(unknown.error().type, RpcError::Type::Status);
+        EXPECT_EQ(unknown.error().status, RpcStatus::UnknownMethod);
+
+        // Nothing Listens on the Port Below the Server's Probe Range
+        auto refused = client.call(address, 18269, rpcMethodId("test.nap"), {}).get();
+        ASSERT_FALSE(refused.has_value());
+        EXPECT_EQ(refused.error().type, RpcError::Type::Connection);
+    }
+
+    TEST_F(ClientTest, OutstandingCallsFailOnClose) {
+        Client client;
+
+        Nap request{ 300, 1 };
+        auto reply = client.callRpc<Nap, Tag>(address, port, "test.nap", request);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        client.close();
+
+        auto result = reply.get();
+        ASSERT_FALSE(result.has_value());
+        EXPECT_EQ(result.error().type, RpcError::Type::Closed);
+    }
+
+    TEST_F(ClientTest, PeerThatNeverReadsStallsOnlyItself) {
+        auto* resource = std::pmr::get_default_resource();
+        PosixSocket hog(resource);
+        ASSERT_EQ(hog.init().type, SocketError::Type::None);
+        int receiveBuffer = 4096;
+        setsockopt(static_cast<int>(hog.getNativeHandle()), SOL_SOCKET, SO_RCVBUF, &receiveBuffer, sizeof(receiveBuffer));
+        ASSERT_EQ(hog.connect(address, port).type, SocketError::Type::None);
+
+        // Far More Reply Bytes Than Both Kernel Buffers Hold, and None are Ever Read
+        std::pmr::vector<uint8_t> calls(resource);
+        for (uint64_t i = 0; i < 256; ++i) {
+            RpcFrame frame;
+            frame.methodId = rpcMethodId("test.blob");
+            frame.requestId = i;
+            std::array<uint8_t, RpcFrameCodec::MaxHeaderBytes> header;
+            size_t headerSize = RpcFrameCodec::encodeHeader(frame, header);
+            calls.insert(calls.end(), header.begin(), header.begin() + headerSize);
+        }
+        ASSERT_EQ(hog.send(calls).type, SocketError::Type::None);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        // Workers Waiting on the Hog Would Leave None for This Call
+        Client client;
+        Nap request{ 0, 7 };
+        auto reply = client.callRpc<Nap, Tag>(address, port, "test.nap", request).get();
+        ASSERT_TRUE(reply.has_value());
+        EXPECT_EQ(reply.value().tag, 7u);
+
+        // Nor May stop() Wait for the Hog to Drain its Replies
+        server->stop();
+        hog.close();
+    }
+}
+
+#endif
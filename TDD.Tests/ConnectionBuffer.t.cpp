@@ -0,0 +1,78 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "ConnectionBuffer.h"
+#include <memory_resource>
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+namespace ConnectionBufferTests {
+    void append(ConnectionBuffer& buffer, const std::vector<uint8_t>& bytes) {
+        auto space = buffer.writable(bytes.size());
+        ASSERT_GE(space.size(), bytes.size());
+        std::memcpy(space.data(), bytes.data(), bytes.size());
+        buffer.commit(bytes.size());
+    }
+
+    std::vector<uint8_t> sequence(size_t count, uint8_t first) {
+        std::vector<uint8_t> bytes(count);
+        std::iota(bytes.begin(), bytes.end(), first);
+        return bytes;
+    }
+
+    TEST(ConnectionBuffer, NothingIsAllocatedBeforeTheFirstRead) {
+        ConnectionBuffer buffer(std::pmr::get_default_resource());
+        EXPECT_EQ(buffer.capacity(), 0u);
+        EXPECT_TRUE(buffer.readable().empty());
+    }
+
+    TEST(ConnectionBuffer, ReadableStaysContiguousAcrossTheEnd) {
+        constexpr size_t Size = ConnectionBuffer::MirrorThreshold;
+        ConnectionBuffer buffer(std::pmr::get_default_resource(), Size, Size);
+        size_t capacity = buffer.writable().size();
+
+        // Leave a Partial Request Near the End, Then Append Past it
+        append(buffer, sequence(capacity - 100, 0));
+        buffer.consume(capacity - 200);
+        auto tail = sequence(300, 7);
+        append(buffer, tail);
+
+        auto readable = buffer.readable();
+        ASSERT_EQ(readable.size(), 400u);
+        EXPECT_TRUE(std::equal(tail.begin(), tail.end(), readable.begin() + 100));
+        EXPECT_EQ(buffer.capacity(), capacity);
+        EXPECT_EQ(buffer.growthCount(), 0u);
+    }
+
+    TEST(ConnectionBuffer, GrowsUpToTheLimitKeepingUnconsumedBytes) {
+        ConnectionBuffer buffer(std::pmr::get_default_resource(), 4096, 64 * 1024);
+        auto head = sequence(3000, 1);
+        append(buffer, head);
+        buffer.consume(1000);
+
+        append(buffer, sequence(20000, 3));
+        EXPECT_GE(buffer.capacity(), 22000u);
+        EXPECT_GT(buffer.growthCount(), 0u);
+        EXPECT_EQ(buffer.size(), 22000u);
+        EXPECT_TRUE(std::equal(head.begin() + 1000, head.end(), buffer.readable().begin()));
+        EXPECT_EQ(buffer.highWaterMark(), 22000u);
+    }
+
+    TEST(ConnectionBuffer, FullAtTheLimitHasNoWritableSpace) {
+        ConnectionBuffer buffer(std::pmr::get_default_resource(), 4096, 8192);
+        while (true) {
+            auto space = buffer.writable(4096);
+            if (space.empty()) {
+                break;
+            }
+            buffer.commit(space.size());
+        }
+        EXPECT_EQ(buffer.size(), buffer.capacity());
+        EXPECT_GE(buffer.capacity(), 8192u);
+
+        // Consuming Frees Space Again Without Growing
+        buffer.consume(100);
+        EXPECT_EQ(buffer.writable(4096).size(), 100u);
+    }
+}
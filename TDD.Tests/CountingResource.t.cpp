@@ -0,0 +1,42 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "CountingResource.h"
+#include <memory_resource>
+#include <vector>
+
+namespace CountingResourceTests {
+    TEST(CountingResource, CountsWhatReachesUpstream) {
+        CountingResource counting;
+        {
+            std::pmr::vector<int> values(&counting);
+            values.reserve(16);
+
+            auto counts = counting.counts();
+            EXPECT_EQ(counts.allocations, 1u);
+            EXPECT_EQ(counts.deallocations, 0u);
+            EXPECT_EQ(counts.bytesAllocated, 16 * sizeof(int));
+            EXPECT_EQ(counts.bytesOutstanding, 16 * sizeof(int));
+        }
+
+        auto counts = counting.counts();
+        EXPECT_EQ(counts.deallocations, 1u);
+        EXPECT_EQ(counts.bytesOutstanding, 0u);
+    }
+
+    TEST(CountingResource, ResetKeepsOutstandingBytes) {
+        std::pmr::monotonic_buffer_resource arena;
+        CountingResource counting(&arena);
+        EXPECT_EQ(counting.upstream(), &arena);
+
+        void* block = counting.allocate(64, 8);
+        counting.reset();
+
+        auto counts = counting.counts();
+        EXPECT_EQ(counts.allocations, 0u);
+        EXPECT_EQ(counts.bytesAllocated, 0u);
+        EXPECT_EQ(counts.bytesOutstanding, 64u);
+
+        counting.deallocate(block, 64, 8);
+        EXPECT_EQ(counting.counts().bytesOutstanding, 0u);
+    }
+}
@@ -0,0 +1,245 @@
+#include "pch.h"
+
+#ifdef __linux__
+
+#include <gtest/gtest.h>
+#include "EventLoop.h"
+#include "PosixSocket.h"
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <string>
+#include <memory_resource>
+
+namespace EventLoopTests {
+    using namespace std::chrono_literals;
+
+    class EventLoopTest : public ::testing::Test {
+    protected:
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource();
+        std::shared_ptr<BumpMemoryManager> memoryManager = std::make_shared<BumpMemoryManager>(4 * 1024 * 1024);
+        std::unique_ptr<PosixSocket> listener;
+        uint16_t port = 0;
+
+        void SetUp() override {
+            listener = std::make_unique<PosixSocket>(resource);
+            ASSERT_EQ(listener->init().type, SocketError::Type::None);
+
+            // Find a Free Loopback Port
+            for (port = 18570; port < 18670; ++port) {
+                if (listener->bind(std::pmr::string("127.0.0.1", resource), port).type == SocketError::Type::None) {
+                    break;
+                }
+            }
+            ASSERT_EQ(listener->listen(16).type, SocketError::Type::None);
+        }
+
+        void TearDown() override {
+            listener->close();
+        }
+
+        EventLoop::SessionPtr makeSession(std::shared_ptr<Socket> socket) {
+            return make_pmr_unique_ptr<ClientSession>(
+                resource, std::move(socket), memoryManager->createClientResource(64 * 1024), nullptr);
+        }
+
+        template<class Predicate>
+        static bool eventually(Predicate&& predicate, std::chrono::milliseconds timeout = 2s) {
+            auto deadline = std::chrono::steady_clock::now() + timeout;
+            while (!predicate() && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::sleep_for(1ms);
+            }
+            return predicate();
+        }
+
+        // Small Receive Window so the Server's Output Backs Up Quickly
+        std::unique_ptr<PosixSocket> connectClient() {
+            auto client = std::make_unique<PosixSocket>(resource);
+            EXPECT_EQ(client->init().type, SocketError::Type::None);
+            int fd = static_cast<int>(client->getNativeHandle());
+            int window = 4096;
+            setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &window, sizeof(window));
+            timeval timeout{ 2, 0 };
+            setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+            EXPECT_EQ(client->connect(std::pmr::string("127.0.0.1", resource), port).type, SocketError::Type::None);
+            return client;
+        }
+
+        // Everything Until the Peer Closes or a Read Times Out
+        std::string readAll(PosixSocket& client, size_t limit) {
+            std::string received;
+            while (received.size() < limit) {
+                auto chunk = client.receive(64 * 1024);
+                if (!chunk.has_value() || chunk.value().empty()) {
+                    break;
+                }
+                received.append(chunk.value().begin(), chunk.value().end());
+            }
+            return received;
+        }
+
+        static std::pmr::vector<uint8_t> pattern(size_t size) {
+            std::pmr::vector<uint8_t> bytes(size);
+            for (size_t i = 0; i < size; ++i) {
+                bytes[i] = static_cast<uint8_t>(i % 251);
+            }
+            return bytes;
+        }
+
+        static bool matchesPattern(const std::string& received) {
+            for (size_t i = 0; i < received.size(); ++i) {
+                if (static_cast<uint8_t>(received[i]) != static_cast<uint8_t>(i % 251)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Mirrors the Server's Handler: Flush on Writable, Otherwise Read and
+        // Hand Each Received Batch to onInput
+        template<class OnInput>
+        static EventLoop::SessionEventHandler reader(OnInput onInput) {
+            return [onInput](ClientSession& session, uint32_t events) {
+                if (events & IOEngine::Error) {
+                    session.markInactive();
+                    return;
+                }
+                if (session.getState() == ClientSession::State::Writing) {
+                    if (events & IOEngine::Writable) {
+                        session.flushOutput();
+                    }
+                    return;
+                }
+
+                auto& input = session.getInputBuffer();
+                while (session.getState() == ClientSession::State::Reading) {
+                    auto received = session.getSocket()->receiveInto(input.writable(ClientSession::ReadChunkSize));
+                    if (!received.has_value() || received.value() == 0) {
+                        if (!received.has_value() && received.error().type == SocketError::Type::WouldBlock) {
+                            return;
+                        }
+                        session.markInactive();
+                        return;
+                    }
+                    session.updateLastActivityTime();
+                    input.commit(received.value());
+                    input.consume(input.size());
+                    onInput(session);
+                }
+            };
+        }
+    };
+
+    TEST_F(EventLoopTest, PartialWriteResumesWhenTheSocketDrains) {
+        constexpr size_t ReplyBytes = 8 * 1024 * 1024;
+        std::atomic<bool> backedUp{ false };
+        EventLoop loop(IOEngine::createDefault(), resource, reader([&](ClientSession& session) {
+            session.queueOutput(pattern(ReplyBytes));
+            session.flushOutput();
+            backedUp = session.getState() == ClientSession::State::Writing;
+        }));
+        loop.acceptOn(*listener, [this](std::shared_ptr<Socket> socket) { return makeSession(std::move(socket)); });
+        ASSERT_EQ(loop.start().type, SocketError::Type::None);
+
+        auto client = connectClient();
+        ASSERT_EQ(client->send(std::pmr::vector<uint8_t>{ 'g', 'o' }).type, SocketError::Type::None);
+        ASSERT_TRUE(eventually([&] { return backedUp.load(); }));
+
+        // The Rest Goes Out Edge by Edge as the Client Reads, Intact and in Order
+        auto received = readAll(*client, ReplyBytes);
+        EXPECT_EQ(received.size(), ReplyBytes);
+        EXPECT_TRUE(matchesPattern(received));
+        EXPECT_EQ(loop.getSessionCount(), 1u);
+        loop.stop();
+    }
+
+    TEST_F(EventLoopTest, DeferredCloseWaitsForQueuedOutput) {
+        constexpr size_t ReplyBytes = 16 * 1024 * 1024;
+        EventLoop loop(IOEngine::createDefault(), resource, reader([&](ClientSession& session) {
+            session.queueOutput(pattern(ReplyBytes));
+            session.closeAfterOutput();
+            session.flushOutput();
+        }));
+        loop.acceptOn(*listener, [this](std::shared_ptr<Socket> socket) { return makeSession(std::move(socket)); });
+        ASSERT_EQ(loop.start().type, SocketError::Type::None);
+
+        auto client = connectClient();
+        ASSERT_EQ(client->send(std::pmr::vector<uint8_t>{ 'g', 'o' }).type, SocketError::Type::None);
+
+        // Unread Output Keeps the Session Open
+        std::this_thread::sleep_for(100ms);
+        EXPECT_EQ(loop.getSessionCount(), 1u);
+
+        // Every Queued Byte Arrives Before the Close
+        auto received = readAll(*client, ReplyBytes + 1);
+        EXPECT_EQ(received.size(), ReplyBytes);
+        EXPECT_TRUE(matchesPattern(received));
+        EXPECT_TRUE(eventually([&] { return loop.getSessionCount() == 0; }));
+        loop.stop();
+    }
+
+    TEST_F(EventLoopTest, IdleSweepClosesOnlyQuietSessions) {
+        EventLoop loop(IOEngine::createDefault(), resource, reader([](ClientSession&) {}), std::chrono::seconds(1));
+        loop.acceptOn(*listener, [this](std::shared_ptr<Socket> socket) { return makeSession(std::move(socket)); });
+        ASSERT_EQ(loop.start().type, SocketError::Type::None);
+
+        auto quiet = connectClient();
+        auto chatty = connectClient();
+        ASSERT_TRUE(eventually([&] { return loop.getSessionCount() == 2; }));
+
+        // One Byte Every 200 ms Keeps chatty Well Inside the Timeout
+        auto deadline = std::chrono::steady_clock::now() + 4s;
+        while (loop.getSessionCount() == 2 && std::chrono::steady_clock::now() < deadline) {
+            ASSERT_EQ(chatty->send(std::pmr::vector<uint8_t>{ '.' }).type, SocketError::Type::None);
+            std::this_thread::sleep_for(200ms);
+        }
+        EXPECT_EQ(loop.getSessionCount(), 1u);
+
+        // The Quiet Client Sees the Close; the Chatty One is Still Served
+        EXPECT_EQ(readAll(*quiet, 1), "");
+        ASSERT_EQ(chatty->send(std::pmr::vector<uint8_t>{ '.' }).type, SocketError::Type::None);
+        std::this_thread::sleep_for(50ms);
+        EXPECT_EQ(loop.getSessionCount(), 1u);
+        loop.stop();
+    }
+
+    TEST_F(EventLoopTest, ShardRetriesBacklogLeftByDescriptorExhaustion) {
+        EventLoop loop(IOEngine::createDefault(), resource, [](ClientSession&, uint32_t) {});
+        loop.acceptOn(*listener, [this](std::shared_ptr<Socket> socket) { return makeSession(std::move(socket)); });
+        ASSERT_EQ(loop.start().type, SocketError::Type::None);
+
+        // Descriptors for the Clients First; connect() Itself Needs None
+        std::vector<std::unique_ptr<PosixSocket>> clients;
+        for (int i = 0; i < 3; ++i) {
+            clients.push_back(std::make_unique<PosixSocket>(resource));
+            ASSERT_EQ(clients.back()->init().type, SocketError::Type::None);
+        }
+
+        // Cap Descriptors Just Below the Next Free One, so the Loop's accept() Hits EMFILE
+        int probe = ::open("/dev/null", O_RDONLY);
+        ASSERT_GE(probe, 0);
+        ::close(probe);
+        rlimit original{};
+        ASSERT_EQ(getrlimit(RLIMIT_NOFILE, &original), 0);
+        rlimit capped = original;
+        capped.rlim_cur = static_cast<rlim_t>(probe);
+        ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &capped), 0);
+
+        for (auto& client : clients) {
+            EXPECT_EQ(client->connect(std::pmr::string("127.0.0.1", resource), port).type, SocketError::Type::None);
+        }
+        std::this_thread::sleep_for(50ms);
+        EXPECT_EQ(loop.getSessionCount(), 0u);
+
+        // No Further Connection Raises an Edge; the Retry Alone Picks the Backlog Up
+        setrlimit(RLIMIT_NOFILE, &original);
+        EXPECT_TRUE(eventually([&] { return loop.getSessionCount() == clients.size(); }));
+        loop.stop();
+    }
+}
+
+#endif
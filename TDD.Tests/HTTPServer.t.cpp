@@ -0,0 +1,472 @@
+#include "pch.h"
+
+#ifdef __linux__
+
+#include <gtest/gtest.h>
+#include "HTTPServer.h"
+#include "PosixSocket.h"
+#include <sys/socket.h>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <stdexcept>
+
+namespace HTTPServerTests {
+    using namespace std::chrono_literals;
+
+    // Handlers Held on it Give Up After a While, so a Broken Server Fails the Test Instead of Hanging it
+    struct Gate {
+        std::atomic<bool> open{ false };
+        std::atomic<int> waiting{ 0 };
+
+        void wait() {
+            waiting.fetch_add(1);
+            auto deadline = std::chrono::steady_clock::now() + 2s;
+            while (!open && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::sleep_for(1ms);
+            }
+        }
+    };
+
+    class HTTPServerWorkerTest : public ::testing::Test {
+    protected:
+        std::shared_ptr<BumpMemoryManager> memoryManager = std::make_shared<BumpMemoryManager>(16 * 1024 * 1024);
+        std::pmr::memory_resource* resource = memoryManager->getResource();
+        std::unique_ptr<HTTPServer> server;
+        HTTPServer::Config config;      // Tests May Adjust it Before startServer()
+        std::pmr::string address{ "127.0.0.1" };
+        uint16_t port = 0;
+
+        void TearDown() override {
+            if (server) {
+                server->stop();
+            }
+        }
+
+        static HTTPServer::Response echoPath(const HTTPServer::Request& request) {
+            HTTPServer::Response response(200, {}, request.method.get_allocator().resource());
+            response.body.assign(request.path.begin(), request.path.end());
+            return response;
+        }
+
+        // Routes are Added by setup Before the Server Starts
+        template<class Setup>
+        void startServer(ConnectionModel model, size_t workers, size_t blockingWorkers, Setup&& setup) {
+            if (server) {
+                server->stop();
+            }
+
+            config.connectionModel = model;
+            config.eventLoopCount = 1;
+            config.workerCount = workers;
+            config.blockingWorkerCount = blockingWorkers;
+
+            // Find a Free Loopback Port
+            for (port = 18470; port < 18570; ++port) {
+                std::unique_ptr<Socket, PMRDeleter<Socket>> socket(make_pmr_unique_ptr<PosixSocket>(resource, resource));
+                server = std::make_unique<HTTPServer>(std::move(socket), memoryManager, config);
+                setup(*server);
+                if (server->start(address, port).type == SocketError::Type::None) {
+                    return;
+                }
+            }
+            FAIL() << "no free port";
+        }
+
+        std::unique_ptr<PosixSocket> connect() {
+            auto client = std::make_unique<PosixSocket>(resource);
+            EXPECT_EQ(client->init().type, SocketError::Type::None);
+            EXPECT_EQ(client->connect(address, port).type, SocketError::Type::None);
+
+            // A Reply That Never Comes Ends the Read Instead of Blocking
+            timeval timeout{ 1, 0 };
+            setsockopt(static_cast<int>(client->getNativeHandle()), SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+            return client;
+        }
+
+        void send(PosixSocket& client, const std::string& text) {
+            EXPECT_EQ(client.send(std::pmr::vector<uint8_t>(text.begin(), text.end(), resource)).type, SocketError::Type::None);
+        }
+
+        // Bodies of the First count Responses, in Arrival Order; Fewer if the Reads Time Out
+        std::vector<std::string> readBodies(PosixSocket& client, size_t count) {
+            std::vector<std::string> bodies;
+            std::string input;
+            while (bodies.size() < count) {
+                auto headEnd = input.find("\r\n\r\n");
+                if (headEnd != std::string::npos) {
+                    auto lengthAt = input.find("Content-Length: ");
+                    size_t length = lengthAt < headEnd ? std::stoul(input.substr(lengthAt + 16)) : 0;
+                    if (input.size() >= headEnd + 4 + length) {
+                        bodies.push_back(input.substr(headEnd + 4, length));
+                        input.erase(0, headEnd + 4 + length);
+                        continue;
+                    }
+                }
+
+                auto received = client.receive(4096);
+                if (!received.has_value() || received.value().empty()) {
+                    break;
+                }
+                input.append(received.value().begin(), received.value().end());
+            }
+            return bodies;
+        }
+
+        // Raw Bytes Until until Appears, the Peer Closes or a Read Times Out
+        std::string readRaw(PosixSocket& client, std::string_view until = {}) {
+            std::string input;
+            while (until.empty() || input.find(until) == std::string::npos) {
+                auto received = client.receive(64 * 1024);
+                if (!received.has_value() || received.value().empty()) {
+                    break;
+                }
+                input.append(received.value().begin(), received.value().end());
+            }
+            return input;
+        }
+
+        static bool peerClosed(PosixSocket& client) {
+            auto received = client.receive(1);
+            return received.has_value() && received.value().empty();
+        }
+
+        // Up-Front Body, Then "a", an Empty Piece, "bb" and the Last "ccc"
+        static HTTPServer::Response pieces(const HTTPServer::Request& request) {
+            HTTPServer::Response response(200, {}, request.method.get_allocator().resource());
+            std::string_view head = "head-";
+            response.body.assign(head.begin(), head.end());
+            response.producer = [step = 0](HTTPServer::BodyWriter& writer) mutable {
+                constexpr std::string_view Pieces[] = { "a", "", "bb", "ccc" };
+                writer.write(Pieces[step]);
+                return ++step < static_cast<int>(std::size(Pieces));
+            };
+            return response;
+        }
+
+        static std::string get(const std::string& target) {
+            return "GET " + target + " HTTP/1.1\r\nHost: test\r\n\r\n";
+        }
+
+        static std::string post(const std::string& target, const std::string& body) {
+            return "POST " + target + " HTTP/1.1\r\nHost: test\r\nContent-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+        }
+
+        // Answers With the Number of Body Bytes it Was Handed
+        void registerCountingUpload(HTTPServer& server) {
+            std::pmr::vector<std::pmr::string> methods({ std::pmr::string("POST", resource) }, resource);
+            server.registerStreamingHandler(std::pmr::string("/upload", resource), methods, [](const HTTPServer::Request& request) {
+                auto* requestResource = request.method.get_allocator().resource();
+                auto received = std::make_shared<size_t>(0);
+                HTTPServer::BodyStream stream;
+                stream.onData = [received](std::span<const uint8_t> data) { *received += data.size(); };
+                stream.onComplete = [received, requestResource] {
+                    HTTPServer::Response response(200, {}, requestResource);
+                    auto text = std::to_string(*received);
+                    response.body.assign(text.begin(), text.end());
+                    return response;
+                };
+                return stream;
+            });
+        }
+    };
+
+    TEST_F(HTTPServerWorkerTest, HandlersRunOffTheLoopThread) {
+        for (auto model : { ConnectionModel::EventLoop, ConnectionModel::IoUring }) {
+            Gate gate;
+            startServer(model, 2, 0, [&](HTTPServer& server) {
+                server.registerHandler(std::pmr::string("/held", resource), [&](const HTTPServer::Request& request) {
+                    gate.wait();
+                    return echoPath(request);
+                });
+                server.registerHandler(std::pmr::string("/fast", resource), echoPath);
+            });
+
+            // With a Single Loop, an Inline Handler Waiting Here Would Stall the Other Connection
+            auto held = connect();
+            send(*held, get("/held"));
+            while (gate.waiting == 0) {
+                std::this_thread::sleep_for(1ms);
+            }
+
+            auto fast = connect();
+            send(*fast, get("/fast"));
+            auto fastBodies = readBodies(*fast, 1);
+            EXPECT_FALSE(gate.open);
+            ASSERT_EQ(fastBodies.size(), 1u);
+            EXPECT_EQ(fastBodies[0], "/fast");
+
+            gate.open = true;
+            auto heldBodies = readBodies(*held, 1);
+            ASSERT_EQ(heldBodies.size(), 1u);
+            EXPECT_EQ(heldBodies[0], "/held");
+        }
+    }
+
+    TEST_F(HTTPServerWorkerTest, PipelinedResponsesKeepRequestOrder) {
+        for (auto model : { ConnectionModel::EventLoop, ConnectionModel::IoUring }) {
+            startServer(model, 4, 0, [&](HTTPServer& server) {
+                // Earlier Requests Sleep Longer, so a Reordering Server Would Answer Them Last
+                server.registerHandler(std::pmr::string("/echo", resource), [](const HTTPServer::Request& request) {
+                    int index = std::stoi(std::string(request.path.substr(request.path.find('?') + 1)));
+                    std::this_thread::sleep_for(std::chrono::milliseconds((16 - index) % 4));
+                    return echoPath(request);
+                });
+            });
+
+            std::string pipeline;
+            for (int i = 0; i < 16; ++i) {
+                pipeline += get("/echo?" + std::to_string(i));
+            }
+            auto client = connect();
+            send(*client, pipeline);
+
+            auto bodies = readBodies(*client, 16);
+            ASSERT_EQ(bodies.size(), 16u);
+            for (int i = 0; i < 16; ++i) {
+                EXPECT_EQ(bodies[i], "/echo?" + std::to_string(i));
+            }
+        }
+    }
+
+    TEST_F(HTTPServerWorkerTest, BlockingRoutesRunOnTheirOwnPool) {
+        for (auto model : { ConnectionModel::EventLoop, ConnectionModel::IoUring }) {
+            Gate gate;
+            startServer(model, 1, 1, [&](HTTPServer& server) {
+                std::pmr::vector<std::pmr::string> methods({ std::pmr::string("GET", resource) }, resource);
+                server.registerBlockingHandler(std::pmr::string("/slow", resource), methods, [&](const HTTPServer::Request& request) {
+                    gate.wait();
+                    return echoPath(request);
+                });
+                server.registerHandler(std::pmr::string("/fast", resource), echoPath);
+            });
+
+            // The Only Compute Worker Stays Free While the Blocking One Waits
+            auto slow = connect();
+            send(*slow, get("/slow"));
+            while (gate.waiting == 0) {
+                std::this_thread::sleep_for(1ms);
+            }
+
+            auto fast = connect();
+            send(*fast, get("/fast"));
+            auto fastBodies = readBodies(*fast, 1);
+            EXPECT_FALSE(gate.open);
+            ASSERT_EQ(fastBodies.size(), 1u);
+            EXPECT_EQ(fastBodies[0], "/fast");
+
+            gate.open = true;
+            auto slowBodies = readBodies(*slow, 1);
+            ASSERT_EQ(slowBodies.size(), 1u);
+            EXPECT_EQ(slowBodies[0], "/slow");
+        }
+    }
+
+    TEST_F(HTTPServerWorkerTest, StreamingRouteIgnoresBufferedBodyLimit) {
+        config.maxRequestBodySize = 1024;
+        for (auto model : { ConnectionModel::EventLoop, ConnectionModel::IoUring }) {
+            startServer(model, 2, 0, [&](HTTPServer& server) { registerCountingUpload(server); });
+
+            // Whole Body in One Write: Still Streamed, Never Held Against the Buffered Cap
+            auto client = connect();
+            send(*client, post("/upload", std::string(4096, 'x')));
+            auto bodies = readBodies(*client, 1);
+            ASSERT_EQ(bodies.size(), 1u);
+            EXPECT_EQ(bodies[0], "4096");
+
+            // Chunked on the Same Connection
+            send(*client, "POST /upload HTTP/1.1\r\nHost: test\r\nTransfer-Encoding: chunked\r\n\r\n"
+                "400\r\n" + std::string(1024, 'y') + "\r\n"
+                "400\r\n" + std::string(1024, 'z') + "\r\n"
+                "0\r\n\r\n");
+            bodies = readBodies(*client, 1);
+            ASSERT_EQ(bodies.size(), 1u);
+            EXPECT_EQ(bodies[0], "2048");
+        }
+    }
+
+    TEST_F(HTTPServerWorkerTest, StreamedResponseIsChunkedAndEndsWithTheLastChunk) {
+        for (auto model : { ConnectionModel::ThreadPerSession, ConnectionModel::EventLoop, ConnectionModel::IoUring }) {
+            startServer(model, 2, 0, [&](HTTPServer& server) {
+                server.registerHandler(std::pmr::string("/pieces", resource), pieces);
+                server.registerHandler(std::pmr::string("/fast", resource), echoPath);
+            });
+
+            // The Pipelined Request Behind it Shows the Connection Stays Usable
+            auto client = connect();
+            send(*client, get("/pieces") + get("/fast"));
+            auto raw = readRaw(*client, "\r\n0\r\n\r\n");
+            auto headEnd = raw.find("\r\n\r\n");
+            ASSERT_NE(headEnd, std::string::npos);
+            auto head = raw.substr(0, headEnd);
+            EXPECT_NE(head.find("Transfer-Encoding: chunked"), std::string::npos);
+            EXPECT_EQ(head.find("Content-Length"), std::string::npos);
+
+            // The Up-Front Body is the First Chunk; the Empty Piece Emits None
+            size_t bodyEnd = raw.find("\r\n0\r\n\r\n") + 7;
+            EXPECT_EQ(raw.substr(headEnd + 4, bodyEnd - headEnd - 4),
+                "5\r\nhead-\r\n1\r\na\r\n2\r\nbb\r\n3\r\nccc\r\n0\r\n\r\n");
+
+            auto rest = raw.substr(bodyEnd);
+            if (rest.find("/fast") == std::string::npos) {
+                rest += readRaw(*client, "/fast");
+            }
+            EXPECT_TRUE(rest.starts_with("HTTP/1.1 200"));
+            EXPECT_TRUE(rest.ends_with("Content-Length: 5\r\n\r\n/fast"));
+        }
+    }
+
+    TEST_F(HTTPServerWorkerTest, StreamedResponseToHttp10IsDelimitedByClose) {
+        for (auto model : { ConnectionModel::ThreadPerSession, ConnectionModel::EventLoop, ConnectionModel::IoUring }) {
+            startServer(model, 2, 0, [&](HTTPServer& server) {
+                server.registerHandler(std::pmr::string("/pieces", resource), pieces);
+            });
+
+            auto client = connect();
+            send(*client, "GET /pieces HTTP/1.0\r\n\r\n");
+            auto raw = readRaw(*client);
+            auto headEnd = raw.find("\r\n\r\n");
+            ASSERT_NE(headEnd, std::string::npos);
+            auto head = raw.substr(0, headEnd);
+            EXPECT_EQ(head.find("Transfer-Encoding"), std::string::npos);
+            EXPECT_EQ(head.find("Content-Length"), std::string::npos);
+            EXPECT_NE(head.find("Connection: close"), std::string::npos);
+
+            // Unframed, With the End of the Body Marked by the Close Alone
+            EXPECT_EQ(raw.substr(headEnd + 4), "head-abbccc");
+            EXPECT_TRUE(peerClosed(*client));
+        }
+    }
+
+    TEST_F(HTTPServerWorkerTest, ProducerThrowingMidStreamTruncatesTheBody) {
+        for (auto model : { ConnectionModel::ThreadPerSession, ConnectionModel::EventLoop, ConnectionModel::IoUring }) {
+            startServer(model, 2, 0, [&](HTTPServer& server) {
+                server.registerHandler(std::pmr::string("/broken", resource), [](const HTTPServer::Request& request) {
+                    HTTPServer::Response response(200, {}, request.method.get_allocator().resource());
+                    response.producer = [step = 0](HTTPServer::BodyWriter& writer) mutable {
+                        if (step++ == 0) {
+                            writer.write("partial");
+                            return true;
+                        }
+                        throw std::runtime_error("producer failed");
+                    };
+                    return response;
+                });
+            });
+
+            // Headers Already Went Out, so the Only Signal Left is a Close Without the Last Chunk
+            auto client = connect();
+            send(*client, get("/broken"));
+            auto raw = readRaw(*client);
+            auto headEnd = raw.find("\r\n\r\n");
+            ASSERT_NE(headEnd, std::string::npos);
+            EXPECT_EQ(raw.substr(headEnd + 4), "7\r\npartial\r\n");
+            EXPECT_TRUE(peerClosed(*client));
+        }
+    }
+
+    TEST_F(HTTPServerWorkerTest, SlowReaderHoldsBackTheProducer) {
+        constexpr size_t PieceBytes = 64 * 1024;
+        constexpr int PieceCount = 512;
+
+        for (auto model : { ConnectionModel::ThreadPerSession, ConnectionModel::EventLoop, ConnectionModel::IoUring }) {
+            std::atomic<int> pulls{ 0 };
+            startServer(model, 2, 0, [&](HTTPServer& server) {
+                server.registerHandler(std::pmr::string("/large", resource), [&pulls](const HTTPServer::Request& request) {
+                    HTTPServer::Response response(200, {}, request.method.get_allocator().resource());
+                    response.producer = [&pulls, piece = std::string(PieceBytes, 'x')](HTTPServer::BodyWriter& writer) {
+                        writer.write(piece);
+                        return pulls.fetch_add(1) + 1 < PieceCount;
+                    };
+                    return response;
+                });
+            });
+
+            auto client = connect();
+            send(*client, "GET /large HTTP/1.0\r\n\r\n");
+
+            // Unread, the Output Stops Once the Socket Buffers Fill
+            std::this_thread::sleep_for(200ms);
+            int pulledWhileStalled = pulls.load();
+            EXPECT_GT(pulledWhileStalled, 0);
+            EXPECT_LT(pulledWhileStalled, PieceCount / 2);
+
+            auto raw = readRaw(*client);
+            auto headEnd = raw.find("\r\n\r\n");
+            ASSERT_NE(headEnd, std::string::npos);
+            EXPECT_EQ(raw.size() - headEnd - 4, PieceBytes * PieceCount);
+            EXPECT_EQ(pulls.load(), PieceCount);
+        }
+    }
+
+    TEST_F(HTTPServerWorkerTest, PipelinedRequestsAreAnsweredInOneBatch) {
+        for (auto model : { ConnectionModel::ThreadPerSession, ConnectionModel::EventLoop, ConnectionModel::IoUring }) {
+            Gate gate;
+            startServer(model, 0, 0, [&](HTTPServer& server) {
+                server.registerHandler(std::pmr::string("/echo", resource), [&](const HTTPServer::Request& request) {
+                    if (request.path.ends_with("?15")) {
+                        gate.wait();
+                    }
+                    return echoPath(request);
+                });
+            });
+
+            std::string pipeline;
+            for (int i = 0; i < 16; ++i) {
+                pipeline += get("/echo?" + std::to_string(i));
+            }
+            auto client = connect();
+            send(*client, pipeline);
+
+            // Fifteen Answers are Ready, but Nothing Leaves Until the Whole Read is Answered
+            while (gate.waiting == 0) {
+                std::this_thread::sleep_for(1ms);
+            }
+            auto early = client->waitReadable(50ms);
+            ASSERT_TRUE(early.has_value());
+            EXPECT_FALSE(early.value());
+
+            gate.open = true;
+            auto bodies = readBodies(*client, 16);
+            ASSERT_EQ(bodies.size(), 16u);
+            for (int i = 0; i < 16; ++i) {
+                EXPECT_EQ(bodies[i], "/echo?" + std::to_string(i));
+            }
+        }
+    }
+
+    TEST_F(HTTPServerWorkerTest, OversizedBodyGets413AndCloses) {
+        config.maxRequestBodySize = 1024;
+        for (auto model : { ConnectionModel::ThreadPerSession, ConnectionModel::EventLoop, ConnectionModel::IoUring }) {
+            startServer(model, 0, 0, [&](HTTPServer& server) {
+                std::pmr::vector<std::pmr::string> methods({ std::pmr::string("POST", resource) }, resource);
+                server.registerHandlerWithMethods(std::pmr::string("/size", resource), methods, [](const HTTPServer::Request& request) {
+                    HTTPServer::Response response(200, {}, request.method.get_allocator().resource());
+                    auto text = std::to_string(request.body.size());
+                    response.body.assign(text.begin(), text.end());
+                    return response;
+                });
+            });
+
+            // Exactly at the Limit is Fine
+            auto client = connect();
+            send(*client, post("/size", std::string(1024, 'x')));
+            auto bodies = readBodies(*client, 1);
+            ASSERT_EQ(bodies.size(), 1u);
+            EXPECT_EQ(bodies[0], "1024");
+
+            // One Byte Over is Refused From the Head Alone, and the Unread Body Ends the Connection
+            send(*client, post("/size", std::string(1025, 'x')));
+            auto raw = readRaw(*client, "\r\n\r\n");
+            EXPECT_TRUE(raw.starts_with("HTTP/1.1 413")) << raw;
+            EXPECT_NE(raw.find("Connection: close"), std::string::npos);
+            readRaw(*client);
+            EXPECT_TRUE(peerClosed(*client));
+        }
+    }
+}
+
+#endif
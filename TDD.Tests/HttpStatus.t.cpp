@@ -0,0 +1,43 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "HttpStatus.h"
+#include "HttpDate.h"
+#include <string>
+
+namespace HttpStatusTests {
+    TEST(HttpStatus, EveryRegisteredCodeHasAWellFormedLine) {
+        for (const auto& entry : HttpStatus::Registered) {
+            std::string expected = "HTTP/1.1 " + std::to_string(entry.code) + " " + std::string(entry.reason) + "\r\n";
+            EXPECT_EQ(HttpStatus::statusLine(entry.code), expected);
+        }
+    }
+
+    TEST(HttpStatus, UnregisteredCodesAreEmpty) {
+        EXPECT_TRUE(HttpStatus::statusLine(0).empty());
+        EXPECT_TRUE(HttpStatus::statusLine(99).empty());
+        EXPECT_TRUE(HttpStatus::statusLine(299).empty());
+        EXPECT_TRUE(HttpStatus::statusLine(600).empty());
+    }
+
+    TEST(HttpDate, FormatsImfFixdate) {
+        // RFC 9110 Example Timestamp
+        char out[HttpDate::HeaderSize];
+        HttpDate::format(784111777, out);
+        EXPECT_EQ(std::string(out, sizeof(out)), "Date: Sun, 06 Nov 1994 08:49:37 GMT\r\n");
+    }
+
+    TEST(HttpDate, CachedHeaderMatchesCurrentSecond) {
+        auto before = std::time(nullptr);
+        auto header = HttpDate::header();
+        auto after = std::time(nullptr);
+
+        char expectedBefore[HttpDate::HeaderSize];
+        char expectedAfter[HttpDate::HeaderSize];
+        HttpDate::format(before, expectedBefore);
+        HttpDate::format(after, expectedAfter);
+
+        ASSERT_EQ(header.size(), HttpDate::HeaderSize);
+        EXPECT_TRUE(header == std::string_view(expectedBefore, sizeof(expectedBefore))
+            || header == std::string_view(expectedAfter, sizeof(expectedAfter)));
+    }
+}
@@ -0,0 +1,260 @@
+#include "pch.h"
+
+#ifdef __linux__
+
+#include <gtest/gtest.h>
+#include "IoUring.h"
+#include "IoUringLoop.h"
+#include "PosixSocket.h"
+#include <sys/resource.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <memory_resource>
+
+namespace IoUringTests {
+    class IoUringTest : public ::testing::Test {
+    protected:
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource();
+        std::unique_ptr<PosixSocket> listener;
+        IoUring ring;
+        uint16_t port = 0;
+
+        void SetUp() override {
+            // Kernels Without io_uring (or With it Disabled) Skip the Suite
+            auto ringResult = ring.init(IoUring::Options{ 64 });
+            if (ringResult.type != SocketError::Type::None) {
+                GTEST_SKIP() << "io_uring unavailable: " << ringResult.internalCode;
+            }
+
+            listener = std::make_unique<PosixSocket>(resource);
+            ASSERT_EQ(listener->init().type, SocketError::Type::None);
+
+            // Find a Free Loopback Port
+            for (port = 18370; port < 18470; ++port) {
+                if (listener->bind(std::pmr::string("127.0.0.1", resource), port).type == SocketError::Type::None) {
+                    break;
+                }
+            }
+            ASSERT_EQ(listener->listen(16).type, SocketError::Type::None);
+        }
+
+        void TearDown() override {
+            if (listener) {
+                listener->close();
+            }
+        }
+
+        io_uring_cqe waitOne() {
+            io_uring_cqe result{};
+            auto ready = ring.submitAndWait(1000);
+            EXPECT_TRUE(ready.has_value());
+            if (ready.has_value() && ready.value() > 0) {
+                bool taken = false;
+                ring.forEachCompletion([&](const io_uring_cqe& cqe) {
+                    if (!taken) {
+                        result = cqe;
+                        taken = true;
+                    }
+                });
+            }
+            return result;
+        }
+    };
+
+    TEST_F(IoUringTest, WaitTimesOutWithNothingQueued) {
+        auto ready = ring.submitAndWait(10);
+        ASSERT_TRUE(ready.has_value());
+        EXPECT_EQ(ready.value(), 0u);
+    }
+
+    TEST_F(IoUringTest, MultishotAcceptAndProvidedBufferReceive) {
+        ASSERT_EQ(ring.setupBuffers(8, 64).type, SocketError::Type::None);
+
+        io_uring_sqe* accept = ring.getSqe();
+        ASSERT_NE(accept, nullptr);
+        accept->opcode = IORING_OP_ACCEPT;
+        accept->fd = static_cast<int>(listener->getNativeHandle());
+        accept->ioprio = IORING_ACCEPT_MULTISHOT;
+        accept->user_data = 1;
+
+        PosixSocket client(resource);
+        ASSERT_EQ(client.init().type, SocketError::Type::None);
+        ASSERT_EQ(client.connect(std::pmr::string("127.0.0.1", resource), port).type, SocketError::Type::None);
+
+        // Still Armed After the First Connection
+        io_uring_cqe accepted = waitOne();
+        ASSERT_EQ(accepted.user_data, 1u);
+        ASSERT_GE(accepted.res, 0);
+        EXPECT_TRUE(accepted.flags & IORING_CQE_F_MORE);
+        auto server = PosixSocket::fromAccepted(accepted.res, false, resource);
+
+        io_uring_sqe* receive = ring.getSqe();
+        ASSERT_NE(receive, nullptr);
+        receive->opcode = IORING_OP_RECV;
+        receive->fd = accepted.res;
+        receive->flags = IOSQE_BUFFER_SELECT;
+        receive->buf_group = IoUring::BufferGroup;
+        receive->user_data = 2;
+
+        std::pmr::vector<uint8_t> payload({ 7, 8, 9 }, resource);
+        EXPECT_EQ(client.send(payload).type, SocketError::Type::None);
+
+        // The Kernel Picked a Buffer and Says Which
+        io_uring_cqe received = waitOne();
+        ASSERT_EQ(received.user_data, 2u);
+        ASSERT_EQ(received.res, 3);
+        ASSERT_TRUE(received.flags & IORING_CQE_F_BUFFER);
+        auto id = static_cast<uint16_t>(received.flags >> IORING_CQE_BUFFER_SHIFT);
+        auto data = ring.buffer(id, static_cast<size_t>(received.res));
+        EXPECT_TRUE(std::equal(data.begin(), data.end(), payload.begin(), payload.end()));
+        ring.recycleBuffer(id);
+    }
+
+    class IoUringLoopTest : public IoUringTest {
+    protected:
+        std::shared_ptr<BumpMemoryManager> memoryManager = std::make_shared<BumpMemoryManager>(4 * 1024 * 1024);
+
+        // Sessions That Echo Whatever Arrives
+        std::unique_ptr<IoUringLoop> makeEchoLoop() {
+            auto factory = [this](std::shared_ptr<Socket> socket) {
+                return make_pmr_unique_ptr<ClientSession>(
+                    resource, std::move(socket), memoryManager->createClientResource(64 * 1024), nullptr);
+            };
+            auto echo = [](ClientSession& session) {
+                auto& input = session.getInputBuffer();
+                auto bytes = input.readable();
+                if (!bytes.empty()) {
+                    session.queueOutput(std::pmr::vector<uint8_t>(bytes.begin(), bytes.end(), session.getResource()));
+                    input.consume(bytes.size());
+                }
+                return false;
+            };
+            return std::make_unique<IoUringLoop>(resource, factory, echo);
+        }
+
+        std::unique_ptr<PosixSocket> connect() {
+            auto client = std::make_unique<PosixSocket>(resource);
+            EXPECT_EQ(client->init().type, SocketError::Type::None);
+            EXPECT_EQ(client->connect(std::pmr::string("127.0.0.1", resource), port).type, SocketError::Type::None);
+            return client;
+        }
+
+        std::vector<uint8_t> receiveExactly(PosixSocket& client, size_t size) {
+            std::vector<uint8_t> received;
+            while (received.size() < size) {
+                auto chunk = client.receive(size - received.size());
+                if (!chunk.has_value() || chunk.value().empty()) {
+                    break;
+                }
+                received.insert(received.end(), chunk.value().begin(), chunk.value().end());
+            }
+            return received;
+        }
+
+        template<class Predicate>
+        static bool eventually(Predicate&& predicate) {
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+            while (!predicate() && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            return predicate();
+        }
+    };
+
+    TEST_F(IoUringLoopTest, AcceptsAndEchoesOnEveryConnection) {
+        auto loop = makeEchoLoop();
+        loop->acceptOn(*listener, {});
+        ASSERT_EQ(loop->start().type, SocketError::Type::None);
+
+        auto first = connect();
+        auto second = connect();
+        std::pmr::vector<uint8_t> ping({ 'p', 'i', 'n', 'g' }, resource);
+        std::pmr::vector<uint8_t> pong({ 'p', 'o', 'n', 'g', '!' }, resource);
+
+        // Several Sends per Connection, Interleaved
+        for (int round = 0; round < 3; ++round) {
+            EXPECT_EQ(first->send(ping).type, SocketError::Type::None);
+            EXPECT_EQ(second->send(pong).type, SocketError::Type::None);
+            auto firstEcho = receiveExactly(*first, ping.size());
+            auto secondEcho = receiveExactly(*second, pong.size());
+            EXPECT_TRUE(std::equal(firstEcho.begin(), firstEcho.end(), ping.begin(), ping.end()));
+            EXPECT_TRUE(std::equal(secondEcho.begin(), secondEcho.end(), pong.begin(), pong.end()));
+        }
+        EXPECT_EQ(loop->getSessionCount(), 2u);
+        loop->stop();
+    }
+
+    TEST_F(IoUringLoopTest, LargeEchoLeavesInPieces) {
+        auto loop = makeEchoLoop();
+        loop->acceptOn(*listener, {});
+        ASSERT_EQ(loop->start().type, SocketError::Type::None);
+
+        // Larger Than One Provided Buffer, so it Arrives in Several Completions
+        auto client = connect();
+        std::pmr::vector<uint8_t> payload(48 * 1024, resource);
+        for (size_t i = 0; i < payload.size(); ++i) {
+            payload[i] = static_cast<uint8_t>(i * 7);
+        }
+        EXPECT_EQ(client->send(payload).type, SocketError::Type::None);
+        auto echoed = receiveExactly(*client, payload.size());
+        EXPECT_TRUE(std::equal(echoed.begin(), echoed.end(), payload.begin(), payload.end()));
+        loop->stop();
+    }
+
+    TEST_F(IoUringLoopTest, PeerCloseReleasesTheSession) {
+        auto loop = makeEchoLoop();
+        loop->acceptOn(*listener, {});
+        ASSERT_EQ(loop->start().type, SocketError::Type::None);
+
+        auto client = connect();
+        EXPECT_TRUE(eventually([&] { return loop->getSessionCount() == 1; }));
+        client->close();
+        EXPECT_TRUE(eventually([&] { return loop->getSessionCount() == 0; }));
+        loop->stop();
+    }
+
+    TEST_F(IoUringLoopTest, AcceptBacksOffWhileDescriptorsRunOut) {
+        auto loop = makeEchoLoop();
+        loop->acceptOn(*listener, {});
+        ASSERT_EQ(loop->start().type, SocketError::Type::None);
+
+        // Descriptors for the Clients First; connect() Itself Needs None
+        std::vector<std::unique_ptr<PosixSocket>> clients;
+        for (int i = 0; i < 3; ++i) {
+            clients.push_back(std::make_unique<PosixSocket>(resource));
+            ASSERT_EQ(clients.back()->init().type, SocketError::Type::None);
+        }
+
+        // Cap Descriptors Just Below the Next Free One, so the Kernel's Accept Hits EMFILE
+        int probe = ::open("/dev/null", O_RDONLY);
+        ASSERT_GE(probe, 0);
+        ::close(probe);
+        rlimit original{};
+        ASSERT_EQ(getrlimit(RLIMIT_NOFILE, &original), 0);
+        rlimit capped = original;
+        capped.rlim_cur = static_cast<rlim_t>(probe);
+        ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &capped), 0);
+
+        for (auto& client : clients) {
+            EXPECT_EQ(client->connect(std::pmr::string("127.0.0.1", resource), port).type, SocketError::Type::None);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        // Re-Arming at Once Would Fail Again at Once, Entering the Kernel Nonstop
+        size_t entersBefore = loop->getEnterCount();
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        size_t entersWhileExhausted = loop->getEnterCount() - entersBefore;
+        EXPECT_EQ(loop->getSessionCount(), 0u);
+        EXPECT_LT(entersWhileExhausted, 50u);
+
+        // The Retry Alone Picks the Backlog Up Once Descriptors Free Up
+        setrlimit(RLIMIT_NOFILE, &original);
+        EXPECT_TRUE(eventually([&] { return loop->getSessionCount() == clients.size(); }));
+        loop->stop();
+    }
+}
+
+#endif
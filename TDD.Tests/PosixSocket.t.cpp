@@ -0,0 +1,249 @@
+#include "pch.h"
+
+#ifdef __linux__
+
+#include <gtest/gtest.h>
+#include "PosixSocket.h"
+#include "EpollEngine.h"
+#include "AcceptDrain.h"
+#include <sys/resource.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <thread>
+#include <algorithm>
+#include <memory_resource>
+
+namespace PosixImplementation {
+    class PosixSocketTest : public ::testing::Test {
+    protected:
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource();
+        std::unique_ptr<PosixSocket> listener;
+        uint16_t port = 0;
+
+        void SetUp() override {
+            listener = std::make_unique<PosixSocket>(resource);
+            ASSERT_EQ(listener->init().type, SocketError::Type::None);
+
+            // Find a Free Loopback Port
+            for (port = 18070; port < 18170; ++port) {
+                if (listener->bind(std::pmr::string("127.0.0.1", resource), port).type == SocketError::Type::None) {
+                    break;
+                }
+            }
+            ASSERT_EQ(listener->listen(16).type, SocketError::Type::None);
+        }
+
+        void TearDown() override {
+            listener->close();
+        }
+    };
+
+    TEST_F(PosixSocketTest, BindToInvalidAddress) {
+        PosixSocket socket(resource);
+        ASSERT_EQ(socket.init().type, SocketError::Type::None);
+        auto result = socket.bind(std::pmr::string("invalid_address", resource), 8080);
+        EXPECT_EQ(result.type, SocketError::Type::Bind);
+    }
+
+    TEST_F(PosixSocketTest, LoopbackSendReceive) {
+        PosixSocket client(resource);
+        ASSERT_EQ(client.init().type, SocketError::Type::None);
+        ASSERT_EQ(client.connect(std::pmr::string("127.0.0.1", resource), port).type, SocketError::Type::None);
+
+        auto accepted = listener->accept();
+        ASSERT_TRUE(accepted.has_value());
+
+        std::pmr::vector<uint8_t> payload({ 1, 2, 3, 4 }, resource);
+        EXPECT_EQ(client.send(payload).type, SocketError::Type::None);
+
+        auto received = accepted.value()->receive(1024);
+        ASSERT_TRUE(received.has_value());
+        EXPECT_EQ(received.value(), payload);
+    }
+
+    TEST_F(PosixSocketTest, ReceiveIntoFillsCallerBuffer) {
+        PosixSocket client(resource);
+        ASSERT_EQ(client.init().type, SocketError::Type::None);
+        ASSERT_EQ(client.connect(std::pmr::string("127.0.0.1", resource), port).type, SocketError::Type::None);
+
+        auto accepted = listener->accept();
+        ASSERT_TRUE(accepted.has_value());
+
+        std::pmr::vector<uint8_t> payload({ 1, 2, 3, 4, 5, 6 }, resource);
+        EXPECT_EQ(client.send(payload).type, SocketError::Type::None);
+
+        // Smaller Than the Payload: the Rest Waits for the Next Read
+        uint8_t buffer[4] = {};
+        auto first = accepted.value()->receiveInto(buffer);
+        ASSERT_TRUE(first.has_value());
+        ASSERT_EQ(first.value(), 4u);
+        EXPECT_TRUE(std::equal(buffer, buffer + 4, payload.begin()));
+
+        auto second = accepted.value()->receiveInto(buffer);
+        ASSERT_TRUE(second.has_value());
+        ASSERT_EQ(second.value(), 2u);
+        EXPECT_EQ(buffer[0], 5);
+        EXPECT_EQ(buffer[1], 6);
+
+        client.close();
+        auto closed = accepted.value()->receiveInto(buffer);
+        ASSERT_TRUE(closed.has_value());
+        EXPECT_EQ(closed.value(), 0u);
+    }
+
+    TEST_F(PosixSocketTest, SendvWritesSegmentsInOrder) {
+        PosixSocket client(resource);
+        ASSERT_EQ(client.init().type, SocketError::Type::None);
+        ASSERT_EQ(client.connect(std::pmr::string("127.0.0.1", resource), port).type, SocketError::Type::None);
+
+        auto accepted = listener->accept();
+        ASSERT_TRUE(accepted.has_value());
+
+        // Body Larger Than the Socket Buffers Forces Partial Writes Mid-Segment
+        std::vector<uint8_t> head = { 'H', 'D', 'R' };
+        std::vector<uint8_t> empty;
+        std::vector<uint8_t> body(4 * 1024 * 1024);
+        for (size_t i = 0; i < body.size(); ++i) {
+            body[i] = static_cast<uint8_t>(i * 31);
+        }
+        std::span<const uint8_t> segments[] = { head, empty, body };
+
+        std::vector<uint8_t> received;
+        std::thread reader([&] {
+            while (received.size() < head.size() + body.size()) {
+                auto chunk = accepted.value()->receive(65536);
+                if (!chunk.has_value() || chunk.value().empty()) break;
+                received.insert(received.end(), chunk.value().begin(), chunk.value().end());
+            }
+        });
+
+        EXPECT_EQ(client.sendv(segments).type, SocketError::Type::None);
+        reader.join();
+
+        ASSERT_EQ(received.size(), head.size() + body.size());
+        EXPECT_TRUE(std::equal(head.begin(), head.end(), received.begin()));
+        EXPECT_TRUE(std::equal(body.begin(), body.end(), received.begin() + head.size()));
+    }
+
+    TEST_F(PosixSocketTest, NonBlockingAcceptWouldBlock) {
+        ASSERT_EQ(listener->setNonBlocking().type, SocketError::Type::None);
+        auto accepted = listener->accept();
+        ASSERT_FALSE(accepted.has_value());
+        EXPECT_EQ(accepted.error().type, SocketError::Type::WouldBlock);
+    }
+
+    TEST_F(PosixSocketTest, ReusePortListenersShareThePort) {
+        // The Fixture's Listener Did Not Opt in, so it Keeps the Port to Itself
+        auto intruder = listener->createSibling();
+        ASSERT_EQ(intruder->init().type, SocketError::Type::None);
+        ASSERT_EQ(intruder->setReusePort().type, SocketError::Type::None);
+        EXPECT_EQ(intruder->bind(std::pmr::string("127.0.0.1", resource), port).type, SocketError::Type::Bind);
+
+        // Listeners That All Opt in Bind Together and Each Gets Connections
+        std::shared_ptr<Socket> shards[2];
+        uint16_t sharedPort = 0;
+        for (sharedPort = port + 1; sharedPort < port + 100; ++sharedPort) {
+            shards[0] = listener->createSibling();
+            ASSERT_EQ(shards[0]->init().type, SocketError::Type::None);
+            ASSERT_EQ(shards[0]->setReusePort().type, SocketError::Type::None);
+            if (shards[0]->bind(std::pmr::string("127.0.0.1", resource), sharedPort).type == SocketError::Type::None) {
+                break;
+            }
+        }
+        shards[1] = listener->createSibling();
+        ASSERT_EQ(shards[1]->init().type, SocketError::Type::None);
+        ASSERT_EQ(shards[1]->setReusePort().type, SocketError::Type::None);
+        ASSERT_EQ(shards[1]->bind(std::pmr::string("127.0.0.1", resource), sharedPort).type, SocketError::Type::None);
+        for (auto& shard : shards) {
+            ASSERT_EQ(shard->listen(64).type, SocketError::Type::None);
+            ASSERT_EQ(shard->setNonBlocking().type, SocketError::Type::None);
+        }
+
+        // Flow Hashing Spreads Distinct Source Ports Over Both
+        std::vector<std::unique_ptr<PosixSocket>> clients;
+        for (int i = 0; i < 32; ++i) {
+            clients.push_back(std::make_unique<PosixSocket>(resource));
+            ASSERT_EQ(clients.back()->init().type, SocketError::Type::None);
+            ASSERT_EQ(clients.back()->connect(std::pmr::string("127.0.0.1", resource), sharedPort).type, SocketError::Type::None);
+        }
+
+        size_t accepted[2] = {};
+        for (size_t i = 0; i < 2; ++i) {
+            while (shards[i]->accept().has_value()) {
+                ++accepted[i];
+            }
+        }
+        EXPECT_EQ(accepted[0] + accepted[1], clients.size());
+        EXPECT_GT(accepted[0], 0u);
+        EXPECT_GT(accepted[1], 0u);
+    }
+
+    TEST_F(PosixSocketTest, DrainStopsOnlyWhenBacklogIsEmptyOrDescriptorsRunOut) {
+        ASSERT_EQ(listener->setNonBlocking().type, SocketError::Type::None);
+        std::atomic<bool> running(true);
+
+        std::vector<std::unique_ptr<PosixSocket>> clients;
+        for (int i = 0; i < 3; ++i) {
+            clients.push_back(std::make_unique<PosixSocket>(resource));
+            ASSERT_EQ(clients.back()->init().type, SocketError::Type::None);
+            ASSERT_EQ(clients.back()->connect(std::pmr::string("127.0.0.1", resource), port).type, SocketError::Type::None);
+        }
+
+        // Cap Descriptors Just Below the Next Free One, so accept() Hits EMFILE
+        int probe = ::open("/dev/null", O_RDONLY);
+        ASSERT_GE(probe, 0);
+        ::close(probe);
+        rlimit original{};
+        ASSERT_EQ(getrlimit(RLIMIT_NOFILE, &original), 0);
+        rlimit capped = original;
+        capped.rlim_cur = static_cast<rlim_t>(probe);
+        ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &capped), 0);
+
+        std::vector<std::shared_ptr<Socket>> accepted;
+        auto collect = [&](std::shared_ptr<Socket> client) { accepted.push_back(std::move(client)); };
+        auto exhausted = drainAccepts(*listener, running, collect);
+        setrlimit(RLIMIT_NOFILE, &original);
+
+        // The Backlog Survives; Draining Again Later Takes All of it
+        EXPECT_EQ(exhausted, AcceptDrain::Exhausted);
+        EXPECT_TRUE(accepted.empty());
+        EXPECT_EQ(drainAccepts(*listener, running, collect), AcceptDrain::Drained);
+        EXPECT_EQ(accepted.size(), clients.size());
+    }
+
+    TEST_F(PosixSocketTest, EpollReportsListenerReadable) {
+        EpollEngine engine;
+        ASSERT_EQ(engine.init().type, SocketError::Type::None);
+        ASSERT_EQ(listener->setNonBlocking().type, SocketError::Type::None);
+        ASSERT_EQ(engine.add(*listener, IOEngine::Readable | IOEngine::EdgeTriggered, listener.get()).type,
+            SocketError::Type::None);
+
+        IOEvent events[4];
+        auto idle = engine.wait(events, 0);
+        ASSERT_TRUE(idle.has_value());
+        EXPECT_EQ(idle.value(), 0u);
+
+        PosixSocket client(resource);
+        ASSERT_EQ(client.init().type, SocketError::Type::None);
+        ASSERT_EQ(client.connect(std::pmr::string("127.0.0.1", resource), port).type, SocketError::Type::None);
+
+        auto ready = engine.wait(events, 1000);
+        ASSERT_TRUE(ready.has_value());
+        ASSERT_EQ(ready.value(), 1u);
+        EXPECT_EQ(events[0].userData, listener.get());
+        EXPECT_TRUE(events[0].events & IOEngine::Readable);
+    }
+
+    TEST_F(PosixSocketTest, EpollWakeupInterruptsWait) {
+        EpollEngine engine;
+        ASSERT_EQ(engine.init().type, SocketError::Type::None);
+        engine.wakeup();
+
+        IOEvent events[4];
+        auto result = engine.wait(events, 1000);
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result.value(), 0u);
+    }
+}
+
+#endif
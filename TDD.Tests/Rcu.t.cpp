@@ -0,0 +1,109 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "Rcu.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <chrono>
+
+namespace RcuTests {
+    TEST(Rcu, SynchronizeWithoutReadersReturns) {
+        RcuDomain domain;
+        domain.synchronize();
+        domain.synchronize();
+        EXPECT_FALSE(RcuDomain::inReadSection());
+    }
+
+    TEST(Rcu, TracksReadSectionsOnTheCallingThread) {
+        RcuDomain domain;
+        {
+            RcuDomain::ReadGuard outer(domain);
+            EXPECT_TRUE(RcuDomain::inReadSection());
+            {
+                RcuDomain::ReadGuard inner(domain);
+                EXPECT_TRUE(RcuDomain::inReadSection());
+            }
+            EXPECT_TRUE(RcuDomain::inReadSection());
+        }
+        EXPECT_FALSE(RcuDomain::inReadSection());
+    }
+
+    TEST(Rcu, SynchronizeWaitsForExistingReaders) {
+        RcuDomain domain;
+        std::atomic<bool> entered(false);
+        std::atomic<bool> release(false);
+        std::atomic<bool> synchronized(false);
+
+        std::thread reader([&] {
+            RcuDomain::ReadGuard guard(domain);
+            entered = true;
+            while (!release) {
+                std::this_thread::yield();
+            }
+        });
+        while (!entered) {
+            std::this_thread::yield();
+        }
+
+        std::thread writer([&] {
+            domain.synchronize();
+            synchronized = true;
+        });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_FALSE(synchronized);
+
+        release = true;
+        reader.join();
+        writer.join();
+        EXPECT_TRUE(synchronized);
+    }
+
+    TEST(Rcu, ReadersNeverSeeReclaimedVersions) {
+        struct Version {
+            int value;
+        };
+        constexpr int Live = 1;
+        constexpr int Reclaimed = -1;
+
+        RcuDomain domain;
+        std::atomic<Version*> current(new Version{ Live });
+        std::atomic<bool> done(false);
+        std::atomic<size_t> violations(0);
+
+        std::vector<std::thread> readers;
+        for (int i = 0; i < 4; ++i) {
+            readers.emplace_back([&] {
+                while (!done) {
+                    RcuDomain::ReadGuard guard(domain);
+                    Version* version = current.load();
+                    for (int spin = 0; spin < 100; ++spin) {
+                        if (version->value != Live) {
+                            ++violations;
+                        }
+                    }
+                }
+            });
+        }
+
+        // Poison Instead of Free so a Premature Reclaim Shows Up as a Value
+        std::vector<Version*> graveyard;
+        for (int update = 0; update < 2000; ++update) {
+            Version* previous = current.exchange(new Version{ Live });
+            domain.synchronize();
+            previous->value = Reclaimed;
+            graveyard.push_back(previous);
+        }
+
+        done = true;
+        for (auto& reader : readers) {
+            reader.join();
+        }
+        EXPECT_EQ(violations.load(), 0u);
+
+        for (auto* version : graveyard) {
+            delete version;
+        }
+        delete current.load();
+    }
+}
@@ -0,0 +1,57 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "RequestArena.h"
+#include "CountingResource.h"
+#include <memory_resource>
+#include <cstdint>
+#include <string>
+
+namespace RequestArenaTests {
+    TEST(RequestArena, ResetRewindsToTheSameMemory) {
+        CountingResource upstream;
+        RequestArena arena(4096, &upstream);
+        EXPECT_EQ(upstream.counts().allocations, 1u);
+
+        void* first = arena.allocate(100, 8);
+        void* second = arena.allocate(200, 8);
+        EXPECT_NE(second, first);
+        EXPECT_GE(arena.bytesInUse(), 300u);
+
+        arena.reset();
+        EXPECT_EQ(arena.bytesInUse(), 0u);
+        EXPECT_EQ(arena.allocate(100, 8), first);
+
+        // Everything Came From the One Buffer
+        EXPECT_EQ(upstream.counts().allocations, 1u);
+    }
+
+    TEST(RequestArena, HonorsAlignment) {
+        RequestArena arena(4096, std::pmr::new_delete_resource());
+        EXPECT_NE(arena.allocate(1, 1), nullptr);
+        for (size_t alignment : { 2, 4, 8, 16, 32, 64 }) {
+            void* ptr = arena.allocate(3, alignment);
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % alignment, 0u) << alignment;
+        }
+
+        // Overflow Blocks Too
+        void* big = arena.allocate(8192, 64);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(big) % 64, 0u);
+    }
+
+    TEST(RequestArena, OverflowIsReturnedOnReset) {
+        CountingResource upstream;
+        RequestArena arena(1024, &upstream);
+
+        {
+            std::pmr::string text(&arena);
+            text.assign(10000, 'x');
+            EXPECT_EQ(text.size(), 10000u);
+        }
+        EXPECT_EQ(arena.overflowCount(), 1u);
+        EXPECT_GT(upstream.counts().bytesOutstanding, 10000u);
+
+        arena.reset();
+        EXPECT_EQ(upstream.counts().bytesOutstanding, 1024u);
+        EXPECT_GE(arena.highWaterMark(), 10000u);
+    }
+}
@@ -0,0 +1,200 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "RequestParser.h"
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace RequestParserTests {
+    std::vector<uint8_t> bytes(std::string_view text) {
+        return std::vector<uint8_t>(text.begin(), text.end());
+    }
+
+    TEST(RequestParser, ParsesSimpleGet) {
+        auto data = bytes("GET /api/data HTTP/1.1\r\nHost: localhost\r\nAccept: */*\r\n\r\n");
+        RequestParser parser;
+
+        ASSERT_EQ(parser.parse(data), RequestParser::Status::Complete);
+        const auto& request = parser.request();
+        EXPECT_EQ(request.method, "GET");
+        EXPECT_EQ(request.path, "/api/data");
+        EXPECT_EQ(request.version, "HTTP/1.1");
+        ASSERT_EQ(request.headers.size(), 2u);
+        EXPECT_EQ(request.header("host"), "localhost");
+        EXPECT_TRUE(request.body.empty());
+        EXPECT_EQ(parser.consumed(), data.size());
+
+        // Views Point Into the Caller's Buffer
+        EXPECT_EQ(request.method.data(), reinterpret_cast<const char*>(data.data()));
+    }
+
+    TEST(RequestParser, ResumesAcrossPartialReads) {
+        auto full = bytes("POST /rpc HTTP/1.1\r\nContent-Length: 5\r\n\r\nhello");
+        std::vector<uint8_t> buffer;
+        RequestParser parser;
+
+        // Feed One Byte at a Time; the Buffer Reallocates Along the Way
+        for (size_t i = 0; i + 1 < full.size(); ++i) {
+            buffer.push_back(full[i]);
+            ASSERT_EQ(parser.parse(buffer), RequestParser::Status::Incomplete) << "at byte " << i;
+        }
+        buffer.push_back(full.back());
+
+        ASSERT_EQ(parser.parse(buffer), RequestParser::Status::Complete);
+        EXPECT_EQ(parser.request().method, "POST");
+        EXPECT_EQ(parser.request().body, "hello");
+        EXPECT_EQ(parser.request().body.data() + 5, reinterpret_cast<const char*>(buffer.data() + buffer.size()));
+    }
+
+    TEST(RequestParser, SplitsPipelinedRequests) {
+        auto data = bytes(
+            "GET /a HTTP/1.1\r\n\r\n"
+            "POST /b HTTP/1.1\r\nContent-Length: 2\r\n\r\nok"
+            "GET /c HTTP/1.1\r\n");
+        std::span<const uint8_t> remaining(data);
+        RequestParser parser;
+
+        ASSERT_EQ(parser.parse(remaining), RequestParser::Status::Complete);
+        EXPECT_EQ(parser.request().path, "/a");
+        remaining = remaining.subspan(parser.consumed());
+        parser.reset();
+
+        ASSERT_EQ(parser.parse(remaining), RequestParser::Status::Complete);
+        EXPECT_EQ(parser.request().path, "/b");
+        EXPECT_EQ(parser.request().body, "ok");
+        remaining = remaining.subspan(parser.consumed());
+        parser.reset();
+
+        EXPECT_EQ(parser.parse(remaining), RequestParser::Status::Incomplete);
+    }
+
+    TEST(RequestParser, AcceptsBareLineFeeds) {
+        auto data = bytes("GET / HTTP/1.0\nConnection: keep-alive\n\n");
+        RequestParser parser;
+
+        ASSERT_EQ(parser.parse(data), RequestParser::Status::Complete);
+        EXPECT_EQ(parser.request().header("Connection"), "keep-alive");
+        EXPECT_TRUE(parser.request().keepAlive());
+    }
+
+    TEST(RequestParser, KeepAliveDefaults) {
+        RequestParser parser;
+        auto http11 = bytes("GET / HTTP/1.1\r\n\r\n");
+        ASSERT_EQ(parser.parse(http11), RequestParser::Status::Complete);
+        EXPECT_TRUE(parser.request().keepAlive());
+
+        parser.reset();
+        auto http10 = bytes("GET / HTTP/1.0\r\n\r\n");
+        ASSERT_EQ(parser.parse(http10), RequestParser::Status::Complete);
+        EXPECT_FALSE(parser.request().keepAlive());
+
+        parser.reset();
+        auto closing = bytes("GET / HTTP/1.1\r\nConnection: Close\r\n\r\n");
+        ASSERT_EQ(parser.parse(closing), RequestParser::Status::Complete);
+        EXPECT_FALSE(parser.request().keepAlive());
+    }
+
+    TEST(RequestParser, RejectsMalformedRequestLine) {
+        auto data = bytes("GARBAGE\r\n\r\n");
+        RequestParser parser;
+
+        EXPECT_EQ(parser.parse(data), RequestParser::Status::Error);
+        EXPECT_EQ(parser.errorStatus(), 400);
+    }
+
+    TEST(RequestParser, RejectsConflictingContentLength) {
+        auto data = bytes("POST / HTTP/1.1\r\nContent-Length: 3\r\nContent-Length: 4\r\n\r\nabcd");
+        RequestParser parser;
+
+        EXPECT_EQ(parser.parse(data), RequestParser::Status::Error);
+        EXPECT_EQ(parser.errorStatus(), 400);
+    }
+
+    TEST(RequestParser, RejectsTooManyHeaders) {
+        std::string text = "GET / HTTP/1.1\r\n";
+        for (size_t i = 0; i <= RequestParser::MaxHeaders; ++i) {
+            text += "X-" + std::to_string(i) + ": v\r\n";
+        }
+        text += "\r\n";
+        auto data = bytes(text);
+        RequestParser parser;
+
+        EXPECT_EQ(parser.parse(data), RequestParser::Status::Error);
+        EXPECT_EQ(parser.errorStatus(), 431);
+    }
+
+    TEST(RequestParser, RejectsOversizedHead) {
+        std::string text = "GET / HTTP/1.1\r\nX-Big: ";
+        text.append(RequestParser::MaxHeaderBytes, 'a');
+        auto data = bytes(text);
+        RequestParser parser;
+
+        EXPECT_EQ(parser.parse(data), RequestParser::Status::Error);
+        EXPECT_EQ(parser.errorStatus(), 431);
+    }
+
+    TEST(RequestParser, RejectsBodyOverLimitFromHeadAlone) {
+        // Only the Head Has Arrived; the Limit Applies to the Declared Length
+        auto data = bytes("POST /rpc HTTP/1.1\r\nContent-Length: 1025\r\n\r\n");
+        RequestParser parser;
+        parser.setMaxBodySize(1024);
+
+        EXPECT_EQ(parser.parse(data), RequestParser::Status::Error);
+        EXPECT_EQ(parser.errorStatus(), 413);
+
+        // Limit Survives reset()
+        parser.reset();
+        EXPECT_EQ(parser.parse(data), RequestParser::Status::Error);
+        EXPECT_EQ(parser.errorStatus(), 413);
+    }
+
+    TEST(RequestParser, StreamingRouteFlagLastsOneRequest) {
+        auto data = bytes("POST /upload HTTP/1.1\r\nContent-Length: 5\r\n\r\nhello");
+        RequestParser parser;
+
+        ASSERT_EQ(parser.parseHead(data), RequestParser::Status::Complete);
+        EXPECT_FALSE(parser.streamingRoute().has_value());
+        parser.setStreamingRoute(true);
+        ASSERT_EQ(parser.parseHead(data), RequestParser::Status::Complete);
+        EXPECT_EQ(parser.streamingRoute(), true);
+
+        parser.reset();
+        EXPECT_FALSE(parser.streamingRoute().has_value());
+    }
+
+    TEST(RequestParser, StopsAtHeadForChunkedBodies) {
+        auto data = bytes("POST /upload HTTP/1.1\r\nTransfer-Encoding: Chunked\r\n\r\n5\r\nhello\r\n0\r\n\r\n");
+        RequestParser parser;
+
+        ASSERT_EQ(parser.parse(data), RequestParser::Status::Complete);
+        EXPECT_TRUE(parser.chunked());
+        EXPECT_TRUE(parser.request().body.empty());
+        EXPECT_EQ(parser.consumed(), parser.headSize());
+        EXPECT_EQ(std::string_view(reinterpret_cast<const char*>(data.data()) + parser.headSize(), 3), "5\r\n");
+    }
+
+    TEST(RequestParser, ParseHeadIgnoresMissingBody) {
+        auto data = bytes("POST /upload HTTP/1.1\r\nContent-Length: 100000000\r\n\r\npartial");
+        RequestParser parser;
+
+        // Head Alone Says Nothing About the Body Limit
+        ASSERT_EQ(parser.parseHead(data), RequestParser::Status::Complete);
+        EXPECT_EQ(parser.request().path, "/upload");
+        EXPECT_EQ(parser.consumed() - parser.headSize(), 100000000u);
+
+        EXPECT_EQ(parser.parse(data), RequestParser::Status::Error);
+        EXPECT_EQ(parser.errorStatus(), 413);
+    }
+
+    TEST(RequestParser, RejectsAmbiguousOrUnsupportedFraming) {
+        RequestParser parser;
+        auto both = bytes("POST / HTTP/1.1\r\nContent-Length: 5\r\nTransfer-Encoding: chunked\r\n\r\n");
+        EXPECT_EQ(parser.parse(both), RequestParser::Status::Error);
+        EXPECT_EQ(parser.errorStatus(), 400);
+
+        parser.reset();
+        auto gzip = bytes("POST / HTTP/1.1\r\nTransfer-Encoding: gzip, chunked\r\n\r\n");
+        EXPECT_EQ(parser.parse(gzip), RequestParser::Status::Error);
+        EXPECT_EQ(parser.errorStatus(), 501);
+    }
+}
\ No newline at end of file
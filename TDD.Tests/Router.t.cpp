@@ -0,0 +1,102 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "Router.h"
+#include <string>
+
+namespace RouterTests {
+    TEST(Router, MatchesLiteralRoutesAcrossSplitEdges) {
+        Router router;
+        ASSERT_TRUE(router.add("/api/users", HttpMethod::Any, 0));
+        ASSERT_TRUE(router.add("/api/orders", HttpMethod::Any, 1));
+        ASSERT_TRUE(router.add("/api", HttpMethod::Any, 2));
+        ASSERT_TRUE(router.add("/", HttpMethod::Any, 3));
+
+        EXPECT_EQ(router.find("/api/users", HttpMethod::Get).routeId, 0u);
+        EXPECT_EQ(router.find("/api/orders", HttpMethod::Get).routeId, 1u);
+        EXPECT_EQ(router.find("/api", HttpMethod::Get).routeId, 2u);
+        EXPECT_EQ(router.find("/", HttpMethod::Get).routeId, 3u);
+
+        EXPECT_FALSE(router.find("/api/user", HttpMethod::Get).found);
+        EXPECT_FALSE(router.find("/api/users/", HttpMethod::Get).found);
+        EXPECT_FALSE(router.find("/apix", HttpMethod::Get).found);
+    }
+
+    TEST(Router, CapturesParameters) {
+        Router router;
+        ASSERT_TRUE(router.add("/users/{id}/posts/{post}", HttpMethod::Get, 7));
+
+        auto match = router.find("/users/42/posts/abc", HttpMethod::Get);
+        ASSERT_TRUE(match.found);
+        EXPECT_EQ(match.routeId, 7u);
+        ASSERT_EQ(match.paramCount, 2u);
+        EXPECT_EQ(match.params[0].name, "id");
+        EXPECT_EQ(match.params[0].value, "42");
+        EXPECT_EQ(match.params[1].name, "post");
+        EXPECT_EQ(match.params[1].value, "abc");
+
+        // Parameters Never Match an Empty Segment
+        EXPECT_FALSE(router.find("/users//posts/abc", HttpMethod::Get).found);
+    }
+
+    TEST(Router, LiteralBeatsParameterBeatsWildcardWithBacktracking) {
+        Router router;
+        ASSERT_TRUE(router.add("/users/me", HttpMethod::Any, 1));
+        ASSERT_TRUE(router.add("/users/{id}", HttpMethod::Any, 2));
+        ASSERT_TRUE(router.add("/users/*rest", HttpMethod::Any, 3));
+        ASSERT_TRUE(router.add("/users/{id}/profile", HttpMethod::Any, 4));
+
+        EXPECT_EQ(router.find("/users/me", HttpMethod::Get).routeId, 1u);
+        EXPECT_EQ(router.find("/users/17", HttpMethod::Get).routeId, 2u);
+        EXPECT_EQ(router.find("/users/17/profile", HttpMethod::Get).routeId, 4u);
+
+        // "me" Literal Has No /profile Child; Falls Back to the Parameter Branch
+        EXPECT_EQ(router.find("/users/me/profile", HttpMethod::Get).routeId, 4u);
+
+        auto wildcard = router.find("/users/17/friends/3", HttpMethod::Get);
+        ASSERT_TRUE(wildcard.found);
+        EXPECT_EQ(wildcard.routeId, 3u);
+        ASSERT_EQ(wildcard.paramCount, 1u);
+        EXPECT_EQ(wildcard.params[0].name, "rest");
+        EXPECT_EQ(wildcard.params[0].value, "17/friends/3");
+    }
+
+    TEST(Router, MethodMasksSelectRouteAndReportAllowed) {
+        Router router;
+        ASSERT_TRUE(router.add("/items", HttpMethod::Get | HttpMethod::Head, 0));
+        ASSERT_TRUE(router.add("/items", HttpMethod::Post, 1));
+
+        EXPECT_EQ(router.find("/items", HttpMethod::Head).routeId, 0u);
+        EXPECT_EQ(router.find("/items", HttpMethod::Post).routeId, 1u);
+
+        auto rejected = router.find("/items", HttpMethod::Delete);
+        EXPECT_FALSE(rejected.found);
+        EXPECT_EQ(rejected.pathMethods, HttpMethod::Get | HttpMethod::Head | HttpMethod::Post);
+        EXPECT_EQ(std::string(HttpMethod::toAllowList(rejected.pathMethods, std::pmr::get_default_resource())),
+            "GET, HEAD, POST");
+
+        EXPECT_EQ(router.find("/nothing", HttpMethod::Get).pathMethods, 0);
+    }
+
+    TEST(Router, ExtensionMethodsOnlyMatchAnyMethodRoutes) {
+        Router router;
+        ASSERT_TRUE(router.add("/any", HttpMethod::Any, 0));
+        ASSERT_TRUE(router.add("/get", HttpMethod::Get, 1));
+
+        EXPECT_EQ(HttpMethod::fromName("PROPFIND"), HttpMethod::Other);
+        EXPECT_TRUE(router.find("/any", HttpMethod::fromName("PROPFIND")).found);
+        EXPECT_FALSE(router.find("/get", HttpMethod::fromName("PROPFIND")).found);
+    }
+
+    TEST(Router, RejectsMalformedPatterns) {
+        Router router;
+        EXPECT_FALSE(router.add("", HttpMethod::Any, 0));
+        EXPECT_FALSE(router.add("/users/{}", HttpMethod::Any, 0));
+        EXPECT_FALSE(router.add("/users/{id", HttpMethod::Any, 0));
+        EXPECT_FALSE(router.add("/users/{id}x", HttpMethod::Any, 0));
+        EXPECT_FALSE(router.add("/files/*/more", HttpMethod::Any, 0));
+        EXPECT_FALSE(router.add("/a}", HttpMethod::Any, 0));
+
+        ASSERT_TRUE(router.add("/users/{id}", HttpMethod::Any, 0));
+        EXPECT_FALSE(router.add("/users/{name}/posts", HttpMethod::Any, 1));
+    }
+}
@@ -0,0 +1,85 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "RpcFrame.h"
+#include <array>
+#include <vector>
+
+namespace RpcFrameTests {
+    std::vector<uint8_t> encode(const RpcFrame& frame) {
+        std::array<uint8_t, RpcFrameCodec::MaxHeaderBytes> header;
+        size_t headerSize = RpcFrameCodec::encodeHeader(frame, header);
+        std::vector<uint8_t> wire(header.begin(), header.begin() + headerSize);
+        wire.insert(wire.end(), frame.payload.begin(), frame.payload.end());
+        return wire;
+    }
+
+    TEST(RpcFrame, EnvelopeIsShortestMessagePack) {
+        std::vector<uint8_t> payload = { 0x91, 0x01 };
+        RpcFrame frame;
+        frame.methodId = 7;
+        frame.requestId = 300;
+        frame.payload = payload;
+
+        // fixint 7, uint16 300, fixint 0, bin8 Length 2, Then the Payload
+        std::vector<uint8_t> expected = { 0, 0, 0, 9, 0x07, 0xcd, 0x01, 0x2c, 0x00, 0xc4, 0x02, 0x91, 0x01 };
+        EXPECT_EQ(encode(frame), expected);
+    }
+
+    TEST(RpcFrame, RoundTripsWideFields) {
+        std::vector<uint8_t> payload(70000, 0xab);
+        RpcFrame frame;
+        frame.methodId = 0xFFFFFFFF;
+        frame.requestId = 0x123456789ABCDEF0ull;
+        frame.status = RpcStatus::HandlerError;
+        frame.payload = payload;
+
+        auto wire = encode(frame);
+        auto result = RpcFrameCodec::decode(wire);
+        ASSERT_EQ(result.status, RpcFrameCodec::Status::Complete);
+        EXPECT_EQ(result.consumed, wire.size());
+        EXPECT_EQ(result.frame.methodId, frame.methodId);
+        EXPECT_EQ(result.frame.requestId, frame.requestId);
+        EXPECT_EQ(result.frame.status, RpcStatus::HandlerError);
+        ASSERT_EQ(result.frame.payload.size(), payload.size());
+        EXPECT_EQ(result.frame.payload.data(), wire.data() + wire.size() - payload.size());
+    }
+
+    TEST(RpcFrame, IncompleteUntilLastByte) {
+        std::vector<uint8_t> payload = { 1, 2, 3 };
+        RpcFrame frame;
+        frame.methodId = 1;
+        frame.requestId = 2;
+        frame.payload = payload;
+
+        auto wire = encode(frame);
+        auto second = encode(frame);
+        for (size_t length = 0; length < wire.size(); ++length) {
+            auto result = RpcFrameCodec::decode(std::span<const uint8_t>(wire.data(), length));
+            EXPECT_EQ(result.status, RpcFrameCodec::Status::Incomplete) << length;
+        }
+
+        // Back-to-Back Frames: Only the First is Consumed
+        wire.insert(wire.end(), second.begin(), second.end());
+        auto result = RpcFrameCodec::decode(wire);
+        ASSERT_EQ(result.status, RpcFrameCodec::Status::Complete);
+        EXPECT_EQ(result.consumed, second.size());
+    }
+
+    TEST(RpcFrame, RejectsMalformedAndOversized) {
+        // Length Over the Limit Fails From the Prefix Alone
+        std::vector<uint8_t> oversized = { 0x00, 0x10, 0x00, 0x00 };
+        EXPECT_EQ(RpcFrameCodec::decode(oversized, 1024).status, RpcFrameCodec::Status::Error);
+
+        // Method Id as a String
+        std::vector<uint8_t> badType = { 0, 0, 0, 5, 0xa1, 'x', 0x01, 0x00, 0xc4 };
+        EXPECT_EQ(RpcFrameCodec::decode(badType).status, RpcFrameCodec::Status::Error);
+
+        // Payload Claims More Bytes Than the Frame Holds
+        std::vector<uint8_t> overrun = { 0, 0, 0, 6, 0x01, 0x01, 0x00, 0xc4, 0x05, 0xff };
+        EXPECT_EQ(RpcFrameCodec::decode(overrun).status, RpcFrameCodec::Status::Error);
+
+        // Method Id Wider Than 32 Bits
+        std::vector<uint8_t> wideMethod = { 0, 0, 0, 13, 0xcf, 0, 0, 0, 1, 0, 0, 0, 0, 0x01, 0x00, 0xc4, 0x00 };
+        EXPECT_EQ(RpcFrameCodec::decode(wideMethod).status, RpcFrameCodec::Status::Error);
+    }
+}
@@ -0,0 +1,81 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "RpcMethod.h"
+#include <string>
+#include <vector>
+
+namespace RpcMethodTests {
+    struct Sum {
+        int32_t a = 0;
+        int32_t b = 0;
+
+        template<class T>
+        void pack(T& pack) {
+            pack(a, b);
+        }
+    };
+
+    struct Total {
+        int64_t value = 0;
+
+        template<class T>
+        void pack(T& pack) {
+            pack(value);
+        }
+    };
+
+    struct Greeting {
+        std::string text;
+
+        template<class T>
+        void pack(T& pack) {
+            pack(text);
+        }
+    };
+
+    Total add(const Sum& request) {
+        return Total{ int64_t(request.a) + request.b };
+    }
+
+    using Calculator = RpcService<
+        RpcMethod<"calc.add", &add>,
+        RpcMethod<"calc.greet", [](Greeting& request) { return Greeting{ "hello " + request.text }; }>
+    >;
+
+    static_assert(rpcMethodId("calc.add") == RpcMethod<"calc.add", &add>::id);
+    static_assert(rpcMethodId("calc.add") != rpcMethodId("calc.greet"));
+
+    TEST(RpcMethod, ServiceDispatchesByNameId) {
+        std::pmr::vector<uint8_t> result;
+        auto params = msgpack::pack(Sum{ 40, 2 });
+        ASSERT_EQ(Calculator::dispatch(rpcMethodId("calc.add"), params, result), RpcStatus::Ok);
+        EXPECT_EQ(msgpack::unpack<Total>(result.data(), result.size()).value, 42);
+
+        result.clear();
+        params = msgpack::pack(Greeting{ "rpc" });
+        ASSERT_EQ(Calculator::dispatch(rpcMethodId("calc.greet"), params, result), RpcStatus::Ok);
+        EXPECT_EQ(msgpack::unpack<Greeting>(result.data(), result.size()).text, "hello rpc");
+    }
+
+    TEST(RpcMethod, UnknownIdAndBadParams) {
+        std::pmr::vector<uint8_t> result;
+        auto params = msgpack::pack(Sum{ 1, 2 });
+        EXPECT_EQ(Calculator::dispatch(rpcMethodId("calc.sub"), params, result), RpcStatus::UnknownMethod);
+
+        // Truncated Parameters Never Reach the Handler
+        params.pop_back();
+        EXPECT_EQ(Calculator::dispatch(rpcMethodId("calc.add"), params, result), RpcStatus::BadRequest);
+        EXPECT_TRUE(result.empty());
+    }
+
+    TEST(RpcMethod, InvokeRpcKeepsHandlerState) {
+        int calls = 0;
+        auto counter = [&calls](Sum& request) { ++calls; return Total{ request.a }; };
+
+        std::pmr::vector<uint8_t> result;
+        auto params = msgpack::pack(Sum{ 7, 0 });
+        EXPECT_EQ((invokeRpc<Sum, Total>(counter, params, result)), RpcStatus::Ok);
+        EXPECT_EQ((invokeRpc<Sum, Total>(counter, params, result)), RpcStatus::Ok);
+        EXPECT_EQ(calls, 2);
+    }
+}
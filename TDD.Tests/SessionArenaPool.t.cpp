@@ -0,0 +1,119 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "SessionArenaPool.h"
+#include "BumpMemoryManager.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <string>
+#include <memory_resource>
+
+namespace SessionArenaPoolTests {
+    SessionArenaPool::Config smallPool(size_t count, SessionArenaPool::Overflow overflow = SessionArenaPool::Overflow::Heap) {
+        SessionArenaPool::Config config;
+        config.arenaCount = count;
+        config.arenaSize = 64 * 1024;
+        config.overflow = overflow;
+        return config;
+    }
+
+    TEST(SessionArenaPool, ReleasedArenaIsHandedOutAgain) {
+        SessionArenaPool pool(smallPool(2));
+        EXPECT_EQ(pool.available(), 2u);
+
+        std::byte* first = pool.acquire();
+        std::byte* second = pool.acquire();
+        ASSERT_NE(first, nullptr);
+        ASSERT_NE(second, nullptr);
+        EXPECT_NE(first, second);
+
+        EXPECT_EQ(pool.acquire(), nullptr);
+        EXPECT_EQ(pool.exhaustedCount(), 1u);
+
+        pool.release(first);
+        EXPECT_EQ(pool.available(), 1u);
+        EXPECT_EQ(pool.acquire(), first);
+    }
+
+    TEST(SessionArenaPool, ClientResourceReturnsItsArena) {
+        BumpMemoryManager memoryManager(1024 * 1024, smallPool(1, SessionArenaPool::Overflow::Reject));
+        const auto* pool = memoryManager.getSessionArenaPool();
+        ASSERT_NE(pool, nullptr);
+
+        {
+            auto resource = memoryManager.createClientResource(32 * 1024);
+            ASSERT_NE(resource, nullptr);
+            EXPECT_EQ(pool->available(), 0u);
+
+            std::pmr::string text(2000, 'x', resource.get());
+            EXPECT_EQ(text.size(), 2000u);
+
+            // Exhausted: Reject Hands Out Nothing
+            EXPECT_EQ(memoryManager.createClientResource(32 * 1024), nullptr);
+        }
+
+        EXPECT_EQ(pool->available(), 1u);
+        EXPECT_NE(memoryManager.createClientResource(32 * 1024, true), nullptr);
+    }
+
+    TEST(SessionArenaPool, HeapOverflowStillServes) {
+        BumpMemoryManager memoryManager(1024 * 1024, smallPool(1));
+
+        auto pooled = memoryManager.createClientResource(32 * 1024);
+        auto overflow = memoryManager.createClientResource(32 * 1024);
+        ASSERT_NE(pooled, nullptr);
+        ASSERT_NE(overflow, nullptr);
+        EXPECT_EQ(memoryManager.getSessionArenaPool()->exhaustedCount(), 1u);
+    }
+
+    TEST(SessionArenaPool, ArenaSizeIsWhatTheSessionGets) {
+        BumpMemoryManager memoryManager(1024 * 1024, smallPool(1, SessionArenaPool::Overflow::Reject));
+        const auto* pool = memoryManager.getSessionArenaPool();
+
+        // A Full arenaSize Request Fits Beside the Header; a Null Upstream
+        // Makes Any Spill Past the Arena Throw Instead of Quietly Hitting the Heap
+        auto* previous = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+        auto resource = memoryManager.createClientResource(64 * 1024);
+        std::pmr::set_default_resource(previous);
+        ASSERT_NE(resource, nullptr);
+        EXPECT_EQ(pool->available(), 0u);
+        EXPECT_NO_THROW(resource->deallocate(resource->allocate(62 * 1024, 1), 62 * 1024, 1));
+        resource.reset();
+
+        // Larger Than the Usable Bytes Goes to the Heap, Even With Reject
+        auto larger = memoryManager.createClientResource(64 * 1024 + 1);
+        ASSERT_NE(larger, nullptr);
+        EXPECT_EQ(pool->available(), 1u);
+    }
+
+    TEST(SessionArenaPool, ConcurrentChurnNeverSharesAnArena) {
+        constexpr size_t Threads = 4;
+        SessionArenaPool pool(smallPool(Threads));
+        std::atomic<bool> shared{ false };
+
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < Threads; ++t) {
+            threads.emplace_back([&, t]() {
+                auto mark = static_cast<std::byte>(t + 1);
+                for (int i = 0; i < 20000; ++i) {
+                    std::byte* arena = pool.acquire();
+                    if (!arena) {
+                        continue;
+                    }
+                    arena[0] = mark;
+                    std::this_thread::yield();
+                    if (arena[0] != mark) {
+                        shared = true;
+                    }
+                    pool.release(arena);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        EXPECT_FALSE(shared.load());
+        EXPECT_EQ(pool.available(), Threads);
+    }
+}
@@ -0,0 +1,101 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "ThreadCachingResource.h"
+#include "CountingResource.h"
+#include <memory_resource>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace ThreadCachingResourceTests {
+    TEST(ThreadCachingResource, SizeClassesCoverEveryRequest) {
+        size_t previous = 0;
+        for (size_t bytes = 1; bytes <= ThreadCachingResource::MaxSmallSize; ++bytes) {
+            size_t index = ThreadCachingResource::classIndex(bytes);
+            size_t size = ThreadCachingResource::classSize(index);
+            ASSERT_GE(size, bytes) << bytes;
+            ASSERT_EQ(size % ThreadCachingResource::SmallAlignment, 0u) << bytes;
+            if (index > 0) {
+                ASSERT_LT(ThreadCachingResource::classSize(index - 1), bytes) << bytes;
+            }
+            ASSERT_GE(size, previous);
+            previous = size;
+        }
+        EXPECT_EQ(previous, ThreadCachingResource::MaxSmallSize);
+    }
+
+    TEST(ThreadCachingResource, FreedMemoryIsReused) {
+        CountingResource upstream;
+        ThreadCachingResource resource(&upstream, &upstream);
+
+        void* first = resource.allocate(100, 8);
+        resource.deallocate(first, 100, 8);
+        EXPECT_EQ(resource.allocate(100, 8), first);
+
+        // Churn Stays Within the First Slab
+        for (int i = 0; i < 10000; ++i) {
+            void* ptr = resource.allocate(100, 8);
+            resource.deallocate(ptr, 100, 8);
+        }
+        EXPECT_EQ(upstream.counts().allocations, 1u);
+
+        auto stats = resource.stats();
+        EXPECT_EQ(stats.bytesReserved, ThreadCachingResource::SlabSize);
+        EXPECT_EQ(stats.bytesInUse, ThreadCachingResource::classSize(ThreadCachingResource::classIndex(100)));
+        resource.deallocate(first, 100, 8);
+        EXPECT_EQ(resource.stats().bytesInUse, 0u);
+    }
+
+    TEST(ThreadCachingResource, LargeAndOveralignedGoUpstream) {
+        CountingResource slabs;
+        CountingResource large;
+        ThreadCachingResource resource(&slabs, &large);
+
+        void* big = resource.allocate(100000, 8);
+        void* aligned = resource.allocate(64, 64);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned) % 64, 0u);
+        EXPECT_EQ(large.counts().allocations, 2u);
+        EXPECT_EQ(resource.stats().largeBytesInUse, 100064u);
+
+        resource.deallocate(big, 100000, 8);
+        resource.deallocate(aligned, 64, 64);
+        EXPECT_EQ(large.counts().bytesOutstanding, 0u);
+        EXPECT_EQ(slabs.counts().allocations, 0u);
+    }
+
+    TEST(ThreadCachingResource, ExitingThreadsReturnTheirCaches) {
+        CountingResource upstream;
+        {
+            ThreadCachingResource resource(&upstream, &upstream);
+
+            // Freed on Another Thread Than the One That Allocated
+            std::vector<void*> blocks;
+            std::thread producer([&]() {
+                for (int i = 0; i < 1000; ++i) {
+                    blocks.push_back(resource.allocate(48, 8));
+                }
+            });
+            producer.join();
+
+            std::vector<std::thread> consumers;
+            for (int t = 0; t < 4; ++t) {
+                consumers.emplace_back([&, t]() {
+                    for (size_t i = t; i < blocks.size(); i += 4) {
+                        resource.deallocate(blocks[i], 48, 8);
+                    }
+                });
+            }
+            for (auto& consumer : consumers) {
+                consumer.join();
+            }
+
+            auto stats = resource.stats();
+            EXPECT_EQ(stats.threadCaches, 0u);
+            EXPECT_EQ(stats.bytesInUse, 0u);
+            EXPECT_EQ(stats.bytesCached + stats.bytesSlabTails, stats.bytesReserved);
+        }
+
+        // Slabs Go Back on Destruction
+        EXPECT_EQ(upstream.counts().bytesOutstanding, 0u);
+    }
+}
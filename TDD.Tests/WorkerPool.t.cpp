@@ -0,0 +1,47 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "WorkerPool.h"
+#include <atomic>
+#include <thread>
+#include <memory_resource>
+
+namespace WorkerPoolTests {
+    TEST(WorkerPool, RunsEverySubmittedTask) {
+        WorkerPool pool(4, std::pmr::get_default_resource());
+        pool.start();
+
+        std::atomic<int> ran(0);
+        for (int i = 0; i < 1000; ++i) {
+            pool.submit([&ran] { ran.fetch_add(1); });
+        }
+        while (ran.load() < 1000) {
+            std::this_thread::yield();
+        }
+        pool.stop();
+        EXPECT_EQ(ran.load(), 1000);
+    }
+
+    TEST(WorkerPool, IdleWorkerStealsTaskQueuedBehindBlockedOne) {
+        WorkerPool pool(2, std::pmr::get_default_resource());
+        pool.start();
+
+        std::atomic<bool> release(false);
+        std::atomic<bool> queuedRan(false);
+
+        // Dealt Round-Robin: the Third Task Lands Behind the Blocked First
+        pool.submit([&release] {
+            while (!release) {
+                std::this_thread::yield();
+            }
+        });
+        pool.submit([] {});
+        pool.submit([&queuedRan] { queuedRan = true; });
+
+        while (!queuedRan) {
+            std::this_thread::yield();
+        }
+        release = true;
+        pool.stop();
+        EXPECT_GT(pool.getStealCount(), 0u);
+    }
+}
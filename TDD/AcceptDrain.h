@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Socket.h"
+#include <atomic>
+#include <chrono>
+#include <utility>
+
+// How Draining an Edge-Triggered Listener Ended
+enum class AcceptDrain {
+    Drained,    // Backlog Empty: the Next Edge Announces More
+    Exhausted,  // Out of Descriptors: Connections Remain, Yet No New Edge Will Come for Them
+    Stopped,    // running Went False
+    Failed      // Listener Unusable (e.g. Closed During Shutdown)
+};
+
+// After Exhausted, Drain Again This Much Later Without Waiting for an Edge
+inline constexpr std::chrono::milliseconds AcceptRetryInterval{ 100 };
+
+// Accepts Until the Backlog is Empty, Handing Each Connection to onAccepted.
+// Readiness is Reported Once per Edge, so Only WouldBlock (or Running Out of
+// Descriptors, Which the Caller Retries on a Timer) May End the Drain
+template<class OnAccepted>
+AcceptDrain drainAccepts(Socket& listener, const std::atomic<bool>& running, OnAccepted&& onAccepted) {
+    while (running) {
+        auto clientResult = listener.accept();
+        if (!running) {
+            return AcceptDrain::Stopped;
+        }
+
+        if (!clientResult.has_value()) {
+            switch (clientResult.error().type) {
+            case SocketError::Type::WouldBlock:
+                return AcceptDrain::Drained;
+            case SocketError::Type::Exhausted:
+                return AcceptDrain::Exhausted;
+            default:
+                return AcceptDrain::Failed;
+            }
+        }
+        onAccepted(std::move(clientResult.value()));
+    }
+    return AcceptDrain::Stopped;
+}
@@ -0,0 +1,147 @@
+#include "BodyDecoder.h"
+#include <algorithm>
+
+namespace {
+    constexpr size_t MaxChunkSizeDigits = 15;
+
+    int hexValue(uint8_t c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+
+    // Line Length Including its LF (CR Optional), or 0 if Not Yet Complete
+    size_t lineLength(std::span<const uint8_t> input, size_t limit) {
+        auto end = input.begin() + static_cast<std::ptrdiff_t>(std::min(input.size(), limit));
+        auto lf = std::find(input.begin(), end, uint8_t('\n'));
+        return lf == end ? 0 : static_cast<size_t>(lf - input.begin()) + 1;
+    }
+}
+
+BodyDecoder::BodyDecoder() {
+    resetLength(0);
+}
+
+void BodyDecoder::resetLength(size_t length) {
+    state_ = State::Length;
+    remaining_ = length;
+    decoded_ = 0;
+    trailerBytes_ = 0;
+}
+
+void BodyDecoder::resetChunked() {
+    state_ = State::ChunkSize;
+    remaining_ = 0;
+    decoded_ = 0;
+    trailerBytes_ = 0;
+}
+
+size_t BodyDecoder::decodedSize() const {
+    return decoded_;
+}
+
+BodyDecoder::Status BodyDecoder::fail() {
+    state_ = State::Failed;
+    return Status::Error;
+}
+
+BodyDecoder::Status BodyDecoder::decode(
+    std::span<const uint8_t> input,
+    std::span<const uint8_t>& data,
+    size_t& consumed
+) {
+    consumed = 0;
+
+    while (true) {
+        switch (state_) {
+        case State::Length:
+        case State::ChunkData: {
+            if (remaining_ == 0) {
+                state_ = state_ == State::Length ? State::Done : State::ChunkEnd;
+                break;
+            }
+            if (consumed == input.size()) {
+                return Status::Incomplete;
+            }
+
+            // Hand Out as Much of the Current Run as Has Arrived
+            size_t take = std::min(remaining_, input.size() - consumed);
+            data = input.subspan(consumed, take);
+            consumed += take;
+            remaining_ -= take;
+            decoded_ += take;
+            return Status::Data;
+        }
+
+        case State::ChunkSize: {
+            auto rest = input.subspan(consumed);
+            size_t length = lineLength(rest, MaxLineBytes);
+            if (length == 0) {
+                return rest.size() >= MaxLineBytes ? fail() : Status::Incomplete;
+            }
+
+            // chunk-size [; extensions] CRLF; Extensions are Ignored
+            size_t size = 0;
+            size_t digits = 0;
+            while (digits < length && hexValue(rest[digits]) >= 0) {
+                if (digits == MaxChunkSizeDigits) return fail();
+                size = size * 16 + static_cast<size_t>(hexValue(rest[digits]));
+                ++digits;
+            }
+            if (digits == 0) return fail();
+
+            uint8_t next = rest[digits];
+            if (next != ';' && next != '\r' && next != '\n' && next != ' ' && next != '\t') return fail();
+
+            consumed += length;
+            remaining_ = size;
+            state_ = size == 0 ? State::Trailer : State::ChunkData;
+            break;
+        }
+
+        case State::ChunkEnd: {
+            auto rest = input.subspan(consumed);
+            if (rest.empty()) return Status::Incomplete;
+            if (rest[0] == '\n') {
+                consumed += 1;
+            }
+            else if (rest[0] == '\r') {
+                if (rest.size() < 2) return Status::Incomplete;
+                if (rest[1] != '\n') return fail();
+                consumed += 2;
+            }
+            else {
+                return fail();
+            }
+            state_ = State::ChunkSize;
+            break;
+        }
+
+        case State::Trailer: {
+            // Trailer Fields Until an Empty Line; Dropped, Not Merged Into Headers
+            auto rest = input.subspan(consumed);
+            size_t length = lineLength(rest, MaxLineBytes);
+            if (length == 0) {
+                return rest.size() >= MaxLineBytes ? fail() : Status::Incomplete;
+            }
+
+            trailerBytes_ += length;
+            if (trailerBytes_ > MaxTrailerBytes) return fail();
+
+            consumed += length;
+            bool emptyLine = length == 1 || (length == 2 && rest[0] == '\r');
+            if (emptyLine) {
+                state_ = State::Done;
+            }
+            break;
+        }
+
+        case State::Done:
+            return Status::Done;
+
+        case State::Failed:
+            return Status::Error;
+        }
+    }
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#if !defined(_WIN32)
+#define API
+#elif defined(LIB_EXPORTS)
+#define API __declspec(dllexport)
+#else
+#define API __declspec(dllimport)
+#endif
+
+#include <span>
+#include <cstdint>
+#include <cstddef>
+
+// Resumable Request Body Decoder (Content-Length or Chunked Framing)
+//
+// decode() is Handed the Bytes That Follow Whatever it Consumed Before and
+// Hands Back the Next Run of Body Bytes as a View Into Them, so a Body of
+// Any Size Passes Through Without Being Copied or Held. Framing Bytes
+// (Chunk Sizes, Extensions, Trailers) are Consumed and Dropped.
+class API BodyDecoder {
+public:
+    static constexpr size_t MaxLineBytes = 4096;        // Chunk-Size Line or Trailer Field
+    static constexpr size_t MaxTrailerBytes = 64 * 1024;
+
+    enum class Status {
+        Data,           // data Holds Body Bytes
+        Incomplete,     // Needs More Input
+        Done,           // Body (and Trailers) Fully Consumed
+        Error           // Malformed Framing (Answer 400)
+    };
+
+    BodyDecoder();
+
+    void resetLength(size_t length);
+    void resetChunked();
+
+    // consumed Counts Every Input Byte Used, Framing Included; the Caller
+    // Advances by it Before the Next Call
+    Status decode(std::span<const uint8_t> input, std::span<const uint8_t>& data, size_t& consumed);
+
+    // Body Bytes Produced So Far
+    size_t decodedSize() const;
+
+private:
+    enum class State {
+        Length,
+        ChunkSize,
+        ChunkData,
+        ChunkEnd,
+        Trailer,
+        Done,
+        Failed
+    };
+
+    Status fail();
+
+    State state_;
+    size_t remaining_;
+    size_t decoded_;
+    size_t trailerBytes_;
+};
@@ -0,0 +1,252 @@
+#include "ByteScanner.h"
+#include <atomic>
+#include <cstring>
+#include <bit>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define BYTESCANNER_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(BYTESCANNER_X86) && defined(__GNUC__)
+#define TARGET_SSE42 __attribute__((target("sse4.2")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_SSE42
+#define TARGET_AVX2
+#endif
+
+namespace {
+    // Each Kernel Reads Exactly BlockSize Bytes and Sets Bit i When block[i] is in the Set
+    template<size_t SetSize>
+    uint64_t blockMaskSWAR(const char* block, const char* set) {
+        constexpr uint64_t Ones = 0x0101010101010101ull;
+        constexpr uint64_t Low7 = 0x7F7F7F7F7F7F7F7Full;
+        // Moves the High Bit of Byte k to Bit 56 + k; the Partial Products Never Overlap
+        constexpr uint64_t Gather = 0x0102040810204080ull;
+
+        uint64_t needles[SetSize];
+        for (size_t s = 0; s < SetSize; ++s) {
+            needles[s] = Ones * static_cast<uint8_t>(set[s]);
+        }
+
+        // Eight Bytes per Word: a Byte Equal to the Needle XORs to Zero
+        uint64_t mask = 0;
+        for (size_t i = 0; i < ByteScanner::BlockSize; i += 8) {
+            uint64_t word;
+            std::memcpy(&word, block + i, sizeof(word));
+            if constexpr (std::endian::native == std::endian::big) {
+                word = std::byteswap(word);
+            }
+
+            // High Bit Set Exactly in the Zero Bytes; Adding Only Low Bits Never Borrows Across Lanes
+            uint64_t hits = 0;
+            for (size_t s = 0; s < SetSize; ++s) {
+                uint64_t x = word ^ needles[s];
+                hits |= ~(((x & Low7) + Low7) | x | Low7);
+            }
+            mask |= (((hits >> 7) * Gather) >> 56) << i;
+        }
+        return mask;
+    }
+
+    uint64_t blockMaskSWAR(const char* block, const char* set, size_t setSize) {
+        switch (setSize) {
+        case 1: return blockMaskSWAR<1>(block, set);
+        case 2: return blockMaskSWAR<2>(block, set);
+        case 3: return blockMaskSWAR<3>(block, set);
+        default: return blockMaskSWAR<ByteScanner::MaxSetSize>(block, set);
+        }
+    }
+
+#ifdef BYTESCANNER_X86
+    TARGET_SSE42 uint64_t blockMaskSSE42(const char* block, const char* set, size_t setSize) {
+        constexpr int Mode = _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_BIT_MASK;
+        const __m128i needles = _mm_load_si128(reinterpret_cast<const __m128i*>(set));
+        const int needleCount = static_cast<int>(setSize);
+
+        uint64_t mask = 0;
+        for (size_t i = 0; i < ByteScanner::BlockSize; i += 16) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i));
+            __m128i hits = _mm_cmpestrm(needles, needleCount, chunk, 16, Mode);
+            mask |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_cvtsi128_si32(hits)) & 0xFFFF) << i;
+        }
+        return mask;
+    }
+
+    TARGET_AVX2 uint64_t halfMaskAVX2(const char* half, const __m256i* needles) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(half));
+        __m256i hits = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, needles[0]), _mm256_cmpeq_epi8(chunk, needles[1])),
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, needles[2]), _mm256_cmpeq_epi8(chunk, needles[3])));
+        return static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(hits)));
+    }
+
+    TARGET_AVX2 uint64_t blockMaskAVX2(const char* block, const char* set, size_t) {
+        const __m256i needles[ByteScanner::MaxSetSize] = {
+            _mm256_set1_epi8(set[0]),
+            _mm256_set1_epi8(set[1]),
+            _mm256_set1_epi8(set[2]),
+            _mm256_set1_epi8(set[3])
+        };
+        return halfMaskAVX2(block, needles) | (halfMaskAVX2(block + 32, needles) << 32);
+    }
+
+    bool cpuHasSSE42() {
+#if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 1);
+        return (info[2] & (1 << 20)) != 0;
+#else
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse4.2");
+#endif
+    }
+
+    bool cpuHasAVX2() {
+#if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 1);
+        bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0
+            && (_xgetbv(0) & 0x6) == 0x6;
+        if (!osSavesYmm) return false;
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#else
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+#endif
+    }
+#endif
+
+    ByteScanner::Kernel detectKernel() {
+#ifdef BYTESCANNER_X86
+        if (cpuHasAVX2()) return ByteScanner::Kernel::AVX2;
+        if (cpuHasSSE42()) return ByteScanner::Kernel::SSE42;
+#endif
+        return ByteScanner::Kernel::SWAR;
+    }
+
+    std::atomic<ByteScanner::Kernel>& selectedKernel() {
+        static std::atomic<ByteScanner::Kernel> kernel(detectKernel());
+        return kernel;
+    }
+}
+
+ByteScanner::ByteScanner(const char* data, size_t size, std::string_view set)
+    : ByteScanner(selectedKernel().load(std::memory_order_relaxed), data, size, set) {
+}
+
+ByteScanner::ByteScanner(Kernel kernel, const char* data, size_t size, std::string_view set)
+    : data_(data),
+    size_(size),
+    kernel_(kernel),
+    setSize_(set.size() < MaxSetSize ? set.size() : MaxSetSize),
+    blockStart_(NoBlock),
+    mask_(0) {
+    for (size_t i = 0; i < sizeof(set_); ++i) {
+        set_[i] = i < setSize_ ? set[i] : (set.empty() ? '\0' : set[0]);
+    }
+    if (setSize_ == 0) {
+        size_ = 0;
+    }
+}
+
+void ByteScanner::loadBlock(size_t blockStart) {
+    blockStart_ = blockStart;
+
+    const char* block = data_ + blockStart;
+    size_t available = size_ - blockStart;
+
+    // Partial Final Block is Staged so the Kernels Never Read Past the Input
+    alignas(32) char staged[BlockSize];
+    if (available < BlockSize) {
+        std::memset(staged, 0, sizeof(staged));
+        std::memcpy(staged, block, available);
+        block = staged;
+    }
+
+    switch (kernel_) {
+#ifdef BYTESCANNER_X86
+    case Kernel::AVX2:
+        mask_ = blockMaskAVX2(block, set_, setSize_);
+        break;
+    case Kernel::SSE42:
+        mask_ = blockMaskSSE42(block, set_, setSize_);
+        break;
+#endif
+    default:
+        mask_ = blockMaskSWAR(block, set_, setSize_);
+        break;
+    }
+
+    if (available < BlockSize) {
+        mask_ &= (uint64_t(1) << available) - 1;
+    }
+}
+
+size_t ByteScanner::nextSlow(size_t from) {
+    if (from >= size_) {
+        return size_;
+    }
+
+    // A Lone Byte Needs No Mask; the C Library's memchr is Vectorized Already
+    if (kernel_ == Kernel::SWAR && setSize_ == 1) {
+        const void* hit = std::memchr(data_ + from, set_[0], size_ - from);
+        return hit ? static_cast<size_t>(static_cast<const char*>(hit) - data_) : size_;
+    }
+
+    size_t blockStart = from & ~(BlockSize - 1);
+    if (blockStart != blockStart_) {
+        loadBlock(blockStart);
+    }
+
+    uint64_t pending = mask_ & (~uint64_t(0) << (from - blockStart));
+    while (pending == 0) {
+        blockStart += BlockSize;
+        if (blockStart >= size_) {
+            return size_;
+        }
+        loadBlock(blockStart);
+        pending = mask_;
+    }
+    return blockStart + static_cast<size_t>(std::countr_zero(pending));
+}
+
+ByteScanner::Kernel ByteScanner::activeKernel() {
+    return selectedKernel().load(std::memory_order_relaxed);
+}
+
+bool ByteScanner::isSupported(Kernel kernel) {
+    switch (kernel) {
+    case Kernel::SWAR:
+        return true;
+#ifdef BYTESCANNER_X86
+    case Kernel::SSE42:
+        return cpuHasSSE42();
+    case Kernel::AVX2:
+        return cpuHasAVX2();
+#endif
+    default:
+        return false;
+    }
+}
+
+bool ByteScanner::setKernel(Kernel kernel) {
+    if (!isSupported(kernel)) {
+        return false;
+    }
+    selectedKernel().store(kernel, std::memory_order_relaxed);
+    return true;
+}
+
+const char* ByteScanner::kernelName(Kernel kernel) {
+    switch (kernel) {
+    case Kernel::SSE42: return "sse4.2";
+    case Kernel::AVX2: return "avx2";
+    default: return "swar";
+    }
+}
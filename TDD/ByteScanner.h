@@ -0,0 +1,73 @@
+#pragma once
+
+#if !defined(_WIN32)
+#define API
+#elif defined(LIB_EXPORTS)
+#define API __declspec(dllexport)
+#else
+#define API __declspec(dllimport)
+#endif
+
+#include <string_view>
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+
+// Delimiter Index for the Request Parser
+//
+// Classifies the Input 64 Bytes at a Time Into a Bitmask of Positions
+// Holding Any Byte From a Small Set, Then Walks the Set Bits. One Vector
+// Pass per Block Replaces a Byte Loop per Delimiter. The Portable Kernel
+// Compares Eight Bytes per Word (SWAR); CPUID Picks a Vector Kernel Once,
+// Only Where `Bench scan` Shows it Beating SWAR. setKernel() Overrides the
+// Choice for Tests and Benchmarks.
+class API ByteScanner {
+public:
+    static constexpr size_t MaxSetSize = 4;
+    static constexpr size_t BlockSize = 64;
+
+    enum class Kernel {
+        SWAR,
+        SSE42,
+        AVX2
+    };
+
+    ByteScanner(const char* data, size_t size, std::string_view set);
+    ByteScanner(Kernel kernel, const char* data, size_t size, std::string_view set);
+
+    // Offset of the First Set Byte at or After from, or size if None
+    size_t next(size_t from) {
+        // Fast Path: Answer From the Block Already Classified
+        size_t blockStart = from & ~(BlockSize - 1);
+        if (blockStart == blockStart_) {
+            uint64_t pending = mask_ & (~uint64_t(0) << (from - blockStart));
+            if (pending != 0) {
+                return blockStart + static_cast<size_t>(std::countr_zero(pending));
+            }
+        }
+        return nextSlow(from);
+    }
+
+    static Kernel activeKernel();
+    static bool isSupported(Kernel kernel);
+
+    // Returns False (and Changes Nothing) if the CPU Lacks the Kernel
+    static bool setKernel(Kernel kernel);
+
+    static const char* kernelName(Kernel kernel);
+
+private:
+    static constexpr size_t NoBlock = ~size_t(0);
+
+    size_t nextSlow(size_t from);
+    void loadBlock(size_t blockStart);
+
+    const char* data_;
+    size_t size_;
+    Kernel kernel_;
+    size_t setSize_;
+    alignas(16) char set_[16];   // Unused Lanes Repeat set[0]
+
+    size_t blockStart_;         // Blocks are Loaded Lazily by next()
+    uint64_t mask_;
+};
@@ -1,4 +1,6 @@
-#ifdef LIB_EXPORTS
+#if !defined(_WIN32)
+#define API
+#elif defined(LIB_EXPORTS)
 #define API __declspec(dllexport)
 #else
 #define API __declspec(dllimport)
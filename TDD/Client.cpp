@@ -1 +1,339 @@
-#include "Client.h"
\ No newline at end of file
+#include "Client.h"
+#ifdef _WIN32
+#include "WinsockSocket.h"
+#else
+#include "PosixSocket.h"
+#endif
+#include <algorithm>
+#include <optional>
+#include <array>
+
+namespace {
+    // Upper Bound on How Long Readers Take to Notice a Closed Connection
+    constexpr std::chrono::milliseconds ReadablePollInterval(100);
+
+    constexpr size_t ReceiveSize = 64 * 1024;
+
+    std::unique_ptr<Socket, PMRDeleter<Socket>> platformSocket(std::pmr::memory_resource* resource) {
+#ifdef _WIN32
+        return make_pmr_unique_ptr<WinsockSocket>(resource, resource);
+#else
+        return make_pmr_unique_ptr<PosixSocket>(resource, resource);
+#endif
+    }
+}
+
+Client::Connection::Connection(
+    std::unique_ptr<Socket, PMRDeleter<Socket>> connectionSocket,
+    std::pmr::memory_resource* resource
+) :
+    socket(std::move(connectionSocket)),
+    pending(resource),
+    alive(true),
+    inFlight(0),
+    finished(false) {
+}
+
+Client::Connection::~Connection() {
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        alive = false;
+    }
+    if (reader.joinable()) {
+        reader.join();
+    }
+    socket->close();
+}
+
+Client::Client(std::pmr::memory_resource* resource, Config config, SocketFactory socketFactory) :
+    resource_(resource),
+    config_(config),
+    socketFactory_(socketFactory ? std::move(socketFactory) : SocketFactory(platformSocket)),
+    nextRequestId_(1),
+    endpoints_(resource),
+    slotWaiters_(0) {
+}
+
+Client::~Client() {
+    close();
+}
+
+void Client::close() {
+    std::pmr::deque<Endpoint> closing(resource_);
+    {
+        std::lock_guard<std::mutex> lock(endpointsMutex_);
+        closing.swap(endpoints_);
+    }
+
+    // Each Connection Joins its Reader, Which Fails What is Still Pending
+    closing.clear();
+}
+
+size_t Client::getConnectionCount() const {
+    std::lock_guard<std::mutex> lock(endpointsMutex_);
+    size_t count = 0;
+    for (const auto& endpoint : endpoints_) {
+        count += endpoint.connections.size();
+    }
+    return count;
+}
+
+std::future<Client::Result> Client::call(
+    const std::pmr::string& address,
+    uint16_t port,
+    uint32_t methodId,
+    std::span<const uint8_t> params
+) {
+    auto acquired = acquire(address, port);
+    if (!acquired.has_value()) {
+        return failedCall(acquired.error());
+    }
+    Connection& connection = *acquired.value();
+
+    uint64_t requestId = nextRequestId_.fetch_add(1, std::memory_order_relaxed);
+    std::promise<Result> promise(std::allocator_arg, std::pmr::polymorphic_allocator<>(resource_));
+    auto future = promise.get_future();
+
+    // Registered Before Sending: the Reply Can Beat sendv() Back
+    bool registered = false;
+    {
+        std::lock_guard<std::mutex> lock(connection.pendingMutex);
+        if (connection.alive) {
+            connection.pending.emplace(requestId, std::move(promise));
+            registered = true;
+        }
+    }
+    if (!registered) {
+        release(connection);
+        return failedCall(RpcError{ RpcError::Type::Closed, RpcStatus::Ok, 0 });
+    }
+
+    RpcFrame frame;
+    frame.methodId = methodId;
+    frame.requestId = requestId;
+    frame.payload = params;
+
+    std::array<uint8_t, RpcFrameCodec::MaxHeaderBytes> header;
+    size_t headerSize = RpcFrameCodec::encodeHeader(frame, header);
+    std::array<std::span<const uint8_t>, 2> segments = {
+        std::span<const uint8_t>(header.data(), headerSize),
+        params
+    };
+
+    SocketError sendResult;
+    {
+        std::lock_guard<std::mutex> lock(connection.sendMutex);
+        sendResult = connection.socket->sendv(segments);
+    }
+
+    if (sendResult.type != SocketError::Type::None) {
+        // The Reader May Have Failed it Already; Whoever Removes it Completes it
+        std::optional<std::promise<Result>> orphan;
+        {
+            std::lock_guard<std::mutex> lock(connection.pendingMutex);
+            connection.alive = false;
+            auto entry = connection.pending.find(requestId);
+            if (entry != connection.pending.end()) {
+                orphan = std::move(entry->second);
+                connection.pending.erase(entry);
+            }
+        }
+        if (orphan) {
+            orphan->set_value(std::unexpected(RpcError{ RpcError::Type::Send, RpcStatus::Ok, sendResult.internalCode }));
+            release(connection);
+        }
+    }
+
+    return future;
+}
+
+std::expected<Client::Connection*, RpcError> Client::acquire(const std::pmr::string& address, uint16_t port) {
+    std::unique_lock<std::mutex> lock(endpointsMutex_);
+
+    auto found = std::find_if(endpoints_.begin(), endpoints_.end(), [&](const Endpoint& endpoint) {
+        return endpoint.port == port && endpoint.address == address;
+    });
+    Endpoint& endpoint = found != endpoints_.end() ? *found : endpoints_.emplace_back(address, port, resource_);
+
+    bool mayConnect = true;
+    while (true) {
+        // Reap Connections Whose Reader Has Exited Once Nothing Refers to Them
+        std::erase_if(endpoint.connections, [](const ConnectionPtr& connection) {
+            return connection->finished && connection->inFlight == 0;
+        });
+
+        Connection* best = nullptr;
+        for (auto& connection : endpoint.connections) {
+            if (connection->alive && (!best || connection->inFlight < best->inFlight)) {
+                best = connection.get();
+            }
+        }
+
+        // Grow Only While Every Connection Already Has Calls Outstanding
+        bool idle = best && best->inFlight == 0;
+        bool full = endpoint.connections.size() + endpoint.connecting >= config_.connectionsPerEndpoint;
+        if (!idle && !full && mayConnect) {
+            ++endpoint.connecting;
+            lock.unlock();
+            auto opened = connect(address, port);
+            lock.lock();
+            --endpoint.connecting;
+
+            if (opened.has_value()) {
+                Connection* connection = opened.value().get();
+                ++connection->inFlight;
+                endpoint.connections.push_back(std::move(opened.value()));
+                slotFreed_.notify_all();
+                return connection;
+            }
+
+            // Unreachable: Fail Unless a Connection Already Exists to Queue On
+            bool anyAlive = std::any_of(endpoint.connections.begin(), endpoint.connections.end(),
+                [](const ConnectionPtr& connection) { return connection->alive.load(); });
+            if (!anyAlive && endpoint.connecting == 0) {
+                return std::unexpected(opened.error());
+            }
+            mayConnect = false;
+            continue;
+        }
+
+        if (best && best->inFlight < config_.maxInFlightPerConnection) {
+            ++best->inFlight;
+            return best;
+        }
+
+        // Saturated (or Others are Connecting): Wait for a Reply or a New Connection
+        ++slotWaiters_;
+        slotFreed_.wait_for(lock, ReadablePollInterval);
+        --slotWaiters_;
+    }
+}
+
+std::expected<Client::ConnectionPtr, RpcError> Client::connect(const std::pmr::string& address, uint16_t port) {
+    auto socket = socketFactory_(resource_);
+
+    auto initResult = socket->init();
+    if (initResult.type != SocketError::Type::None) {
+        return std::unexpected(RpcError{ RpcError::Type::Connection, RpcStatus::Ok, initResult.internalCode });
+    }
+
+    auto connectResult = socket->connect(address, port);
+    if (connectResult.type != SocketError::Type::None) {
+        socket->close();
+        return std::unexpected(RpcError{ RpcError::Type::Connection, RpcStatus::Ok, connectResult.internalCode });
+    }
+
+    auto connection = make_pmr_unique_ptr<Connection>(resource_, std::move(socket), resource_);
+    connection->reader = std::thread(&Client::readReplies, this, std::ref(*connection));
+    return connection;
+}
+
+void Client::release(Connection& connection) {
+    connection.inFlight.fetch_sub(1);
+
+    // Sequentially Consistent With the Waiter's Increment: Either it Sees the
+    // Freed Slot or We See it Waiting
+    if (slotWaiters_.load() != 0) {
+        std::lock_guard<std::mutex> lock(endpointsMutex_);
+        slotFreed_.notify_all();
+    }
+}
+
+void Client::readReplies(Connection& connection) {
+    Socket& socket = *connection.socket;
+    std::pmr::vector<uint8_t> input(resource_);
+    std::pmr::vector<uint8_t> readBuffer(ReceiveSize, resource_);
+
+    while (connection.alive) {
+        auto readable = socket.waitReadable(ReadablePollInterval);
+        if (!readable.has_value()) {
+            break;
+        }
+        if (!readable.value()) {
+            continue;
+        }
+
+        auto received = socket.receiveInto(readBuffer);
+        if (!received.has_value()) {
+            if (received.error().type == SocketError::Type::WouldBlock) {
+                continue;
+            }
+            break;
+        }
+        if (received.value() == 0) {
+            break;
+        }
+
+        input.insert(input.end(), readBuffer.begin(), readBuffer.begin() + received.value());
+
+        size_t offset = 0;
+        bool valid = true;
+        while (true) {
+            auto result = RpcFrameCodec::decode(std::span<const uint8_t>(input).subspan(offset), config_.maxFrameSize);
+            if (result.status == RpcFrameCodec::Status::Incomplete) {
+                break;
+            }
+            if (result.status == RpcFrameCodec::Status::Error) {
+                valid = false;
+                break;
+            }
+            offset += result.consumed;
+            complete(connection, result.frame);
+        }
+        input.erase(input.begin(), input.begin() + offset);
+
+        if (!valid) {
+            break;
+        }
+    }
+
+    failPending(connection, RpcError{ RpcError::Type::Closed, RpcStatus::Ok, 0 });
+    connection.finished = true;
+
+    // Waiters May be Holding Out for This Connection; Let Them Reap it
+    if (slotWaiters_.load() != 0) {
+        std::lock_guard<std::mutex> lock(endpointsMutex_);
+        slotFreed_.notify_all();
+    }
+}
+
+void Client::complete(Connection& connection, const RpcFrame& reply) {
+    std::optional<std::promise<Result>> promise;
+    {
+        std::lock_guard<std::mutex> lock(connection.pendingMutex);
+        auto entry = connection.pending.find(reply.requestId);
+        if (entry == connection.pending.end()) {
+            return;
+        }
+        promise = std::move(entry->second);
+        connection.pending.erase(entry);
+    }
+
+    if (reply.status == RpcStatus::Ok) {
+        promise->set_value(std::pmr::vector<uint8_t>(reply.payload.begin(), reply.payload.end(), resource_));
+    }
+    else {
+        promise->set_value(std::unexpected(RpcError{ RpcError::Type::Status, reply.status, 0 }));
+    }
+    release(connection);
+}
+
+void Client::failPending(Connection& connection, RpcError error) {
+    std::pmr::unordered_map<uint64_t, std::promise<Result>> failed(resource_);
+    {
+        std::lock_guard<std::mutex> lock(connection.pendingMutex);
+        connection.alive = false;
+        failed.swap(connection.pending);
+    }
+
+    for (auto& [requestId, promise] : failed) {
+        promise.set_value(std::unexpected(error));
+        release(connection);
+    }
+}
+
+std::future<Client::Result> Client::failedCall(RpcError error) {
+    std::promise<Result> promise(std::allocator_arg, std::pmr::polymorphic_allocator<>(resource_));
+    promise.set_value(std::unexpected(error));
+    return promise.get_future();
+}
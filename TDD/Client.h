@@ -1,5 +1,171 @@
 #pragma once
-class Client
-{
+
+#if !defined(_WIN32)
+#define API
+#elif defined(LIB_EXPORTS)
+#define API __declspec(dllexport)
+#else
+#define API __declspec(dllimport)
+#endif
+
+#include "Socket.h"
+#include "RpcFrame.h"
+#include "RpcMethod.h"
+#include "PMRDeleter.h"
+#include <memory>
+#include <memory_resource>
+#include <functional>
+#include <unordered_map>
+#include <deque>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <future>
+#include <expected>
+#include <span>
+#include <system_error>
+
+struct API RpcError {
+    enum class Type {
+        None,
+        Connection,     // Endpoint Could Not be Reached
+        Send,           // Call Could Not be Written
+        Closed,         // Connection Lost Before the Reply Arrived
+        Status,         // Server Answered With a Non-Ok status
+        Decode          // Reply Did Not Unpack Into the Response Type
+    };
+    Type type;
+    RpcStatus status;
+    int32_t internalCode;
+
+    bool operator==(const RpcError&) const = default;
 };
 
+struct API ClientConfig {
+    size_t connectionsPerEndpoint = 4;
+    size_t maxInFlightPerConnection = 128;  // call() Waits Once Every Connection is Full
+    size_t maxFrameSize = RpcFrameCodec::DefaultMaxFrameBytes;
+};
+
+// Multiplexed Client for RpcServer
+//
+// Keeps a Small Pool of Connections per Endpoint and Pipelines Calls on
+// Them: Each Call Takes a Fresh Request Id and is Written Immediately, and
+// its Future is Completed by the Connection's Reader Thread When the
+// Matching Reply Arrives, in Whatever Order the Server Answers. Calls Go to
+// the Least-Loaded Connection; Another is Opened Only While Every Existing
+// One is Busy, so Steady Traffic Pays the TCP Handshake Once. Thread-Safe.
+class API Client {
+public:
+    using Config = ClientConfig;
+    using Result = std::expected<std::pmr::vector<uint8_t>, RpcError>;
+    using SocketFactory = std::function<std::unique_ptr<Socket, PMRDeleter<Socket>>(std::pmr::memory_resource*)>;
+
+    // resource Must be Thread-Safe (Reader Threads Allocate Replies From it).
+    // Without a Factory, Connections Use the Platform Socket
+    explicit Client(
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource(),
+        Config config = Config(),
+        SocketFactory socketFactory = nullptr
+    );
+    ~Client();
+
+    // params is Written Before Returning, so it Need Not Outlive the Call
+    std::future<Result> call(const std::pmr::string& address, uint16_t port, uint32_t methodId, std::span<const uint8_t> params);
+
+    // Typed Call by Method Name; the Reply Unpacks on get(), in the Waiting Thread
+    template<MsgPackObject Req, MsgPackObject Resp>
+    std::future<std::expected<Resp, RpcError>> callRpc(
+        const std::pmr::string& address,
+        uint16_t port,
+        std::string_view name,
+        Req& request
+    ) {
+        auto params = msgpack::pack(request);
+        auto reply = call(address, port, rpcMethodId(name), params);
+
+        return std::async(std::launch::deferred, [reply = std::move(reply)]() mutable -> std::expected<Resp, RpcError> {
+            auto result = reply.get();
+            if (!result.has_value()) {
+                return std::unexpected(result.error());
+            }
+
+            std::error_code ec;
+            auto response = msgpack::unpack<Resp>(result.value().data(), result.value().size(), ec);
+            if (ec) {
+                return std::unexpected(RpcError{ RpcError::Type::Decode, RpcStatus::Ok, ec.value() });
+            }
+            return response;
+        });
+    }
+
+    // Fails Every Outstanding Call With Closed and Drops Every Connection.
+    // Not to be Called Concurrently With call()
+    void close();
+
+    size_t getConnectionCount() const;
+
+    // Deleted Copy/Move Ops
+    Client(const Client&) = delete;
+    Client& operator=(const Client&) = delete;
+    Client(Client&&) = delete;
+    Client& operator=(Client&&) = delete;
+
+private:
+    struct Connection {
+        std::unique_ptr<Socket, PMRDeleter<Socket>> socket;
+        std::mutex sendMutex;       // One Frame Leaves Whole Before the Next
+
+        // Request Id -> Caller Waiting on it. alive Flips Under pendingMutex,
+        // so a Call Never Registers on a Connection That Has Already Failed
+        std::mutex pendingMutex;
+        std::pmr::unordered_map<uint64_t, std::promise<Result>> pending;
+        std::atomic<bool> alive;
+
+        std::atomic<size_t> inFlight;   // Incremented Under the Pool Lock
+        std::atomic<bool> finished;     // Reader Exited; Safe to Reap
+        std::thread reader;
+
+        Connection(std::unique_ptr<Socket, PMRDeleter<Socket>> connectionSocket, std::pmr::memory_resource* resource);
+        ~Connection();
+    };
+
+    using ConnectionPtr = std::unique_ptr<Connection, PMRDeleter<Connection>>;
+
+    struct Endpoint {
+        std::pmr::string address;
+        uint16_t port;
+        std::pmr::vector<ConnectionPtr> connections;
+        size_t connecting;      // Handshakes in Progress (Count Toward the Pool Size)
+
+        Endpoint(const std::pmr::string& endpointAddress, uint16_t endpointPort, std::pmr::memory_resource* resource)
+            : address(endpointAddress, resource), port(endpointPort), connections(resource), connecting(0) {
+        }
+    };
+
+    // Reserves an In-Flight Slot on the Best Connection, Waiting While Saturated
+    std::expected<Connection*, RpcError> acquire(const std::pmr::string& address, uint16_t port);
+    std::expected<ConnectionPtr, RpcError> connect(const std::pmr::string& address, uint16_t port);
+    void release(Connection& connection);
+
+    void readReplies(Connection& connection);
+    void complete(Connection& connection, const RpcFrame& reply);
+    void failPending(Connection& connection, RpcError error);
+
+    std::future<Result> failedCall(RpcError error);
+
+    std::pmr::memory_resource* resource_;
+    Config config_;
+    SocketFactory socketFactory_;
+    std::atomic<uint64_t> nextRequestId_;
+
+    // Stable Addresses: Endpoints are Only Appended
+    std::pmr::deque<Endpoint> endpoints_;
+    mutable std::mutex endpointsMutex_;
+    std::condition_variable slotFreed_;
+    std::atomic<size_t> slotWaiters_;   // Readers Skip the Wakeup When Nobody Waits
+};
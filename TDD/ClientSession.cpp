@@ -4,14 +4,31 @@
 ClientSession::ClientSession(
     std::shared_ptr<Socket> socket,
     std::unique_ptr<std::pmr::memory_resource, BumpMemoryManager::CustomDeleter> resource,
-    ClientHandlerFunc handler
+    ClientHandlerFunc handler,
+    size_t requestArenaSize
 ) :
     socket_(std::move(socket)),
     resource_(std::move(resource)),
     active_(true),
     lastActivity_(std::chrono::steady_clock::now()),
-    handlerFunc_(std::move(handler))
+    handlerFunc_(std::move(handler)),
+    inBuffer_(resource_.get()),
+    pendingRequest_(nullptr, PMRDeleter<PendingRequest>(resource_.get())),
+    owner_(nullptr),
+    dispatched_(nullptr, PMRDeleter<PendingRequest>(resource_.get())),
+    dispatchReturned_(false),
+    state_(State::Reading),
+    outSegments_(resource_.get()),
+    outHead_(0),
+    outStorage_(resource_.get()),
+    outputSourceDone_(false),
+    closeAfterWrite_(false)
 {
+    // Not Over resource_: Its Pool Hands Oversized Blocks to a Monotonic
+    // Buffer That Never Frees, so Overflow Returned on Reset Would Stay Lost
+    if (requestArenaSize > 0) {
+        requestArena_.emplace(requestArenaSize, std::pmr::get_default_resource());
+    }
 }
 
 ClientSession::~ClientSession() {
@@ -34,6 +51,25 @@ std::pmr::memory_resource* ClientSession::getResource() const {
     return resource_.get();
 }
 
+std::pmr::memory_resource* ClientSession::getRequestResource() {
+    if (requestArena_) {
+        return &*requestArena_;
+    }
+    return resource_.get();
+}
+
+bool ClientSession::resetRequestArena() {
+    if (!requestArena_ || pendingRequest_ || dispatched_ || hasPendingOutput() || outputSource_) {
+        return false;
+    }
+    requestArena_->reset();
+    return true;
+}
+
+size_t ClientSession::getRequestArenaHighWater() const {
+    return requestArena_ ? requestArena_->highWaterMark() : 0;
+}
+
 std::shared_ptr<Socket> ClientSession::getSocket() const {
     return socket_;
 }
@@ -66,4 +102,161 @@ void ClientSession::threadHandler() {
     }
 
     markInactive();
+}
+
+ConnectionBuffer& ClientSession::getInputBuffer() {
+    return inBuffer_;
+}
+
+RequestParser& ClientSession::getParser() {
+    return parser_;
+}
+
+ClientSession::PendingRequest* ClientSession::getPendingRequest() const {
+    return pendingRequest_.get();
+}
+
+void ClientSession::setPendingRequest(PendingRequestPtr request) {
+    pendingRequest_ = std::move(request);
+}
+
+void ClientSession::clearPendingRequest() {
+    pendingRequest_.reset();
+}
+
+void ClientSession::setOwner(Owner* owner) {
+    owner_ = owner;
+}
+
+void ClientSession::dispatch(PendingRequestPtr work) {
+    dispatched_ = std::move(work);
+    dispatchReturned_ = false;
+}
+
+bool ClientSession::isDispatched() const {
+    return dispatched_ && !dispatchReturned_;
+}
+
+void ClientSession::resume() {
+    owner_->resume(*this);
+}
+
+void ClientSession::markReturned() {
+    dispatchReturned_ = true;
+}
+
+ClientSession::PendingRequestPtr ClientSession::takeReturnedWork() {
+    if (!dispatchReturned_) {
+        return PendingRequestPtr(nullptr, PMRDeleter<PendingRequest>(resource_.get()));
+    }
+    dispatchReturned_ = false;
+    return std::move(dispatched_);
+}
+
+ClientSession::State ClientSession::getState() const {
+    return state_;
+}
+
+void ClientSession::queueOutput(std::pmr::vector<uint8_t>&& data) {
+    if (data.empty()) {
+        return;
+    }
+
+    // Moving the Vector Keeps its Heap Buffer, so the Span Stays Valid
+    outSegments_.emplace_back(data.data(), data.size());
+    outStorage_.push_back(OwnedBuffer{ std::move(data) });
+}
+
+void ClientSession::queueStaticOutput(std::span<const uint8_t> data) {
+    if (!data.empty()) {
+        outSegments_.push_back(data);
+    }
+}
+
+void ClientSession::closeAfterOutput() {
+    closeAfterWrite_ = true;
+}
+
+bool ClientSession::hasPendingOutput() const {
+    return outHead_ < outSegments_.size();
+}
+
+void ClientSession::setOutputSource(OutputSource source) {
+    outputSource_ = std::move(source);
+}
+
+bool ClientSession::hasOutputSource() const {
+    return static_cast<bool>(outputSource_);
+}
+
+SocketError ClientSession::flushOutput() {
+    for (auto segments = pendingOutput(); !segments.empty(); segments = pendingOutput()) {
+        auto sendResult = socket_->sendvSome(segments);
+
+        if (!sendResult.has_value()) {
+            if (sendResult.error().type == SocketError::Type::WouldBlock) {
+                return SocketError::success();
+            }
+            state_ = State::Closed;
+            markInactive();
+            return sendResult.error();
+        }
+        advanceOutput(sendResult.value());
+    }
+    return SocketError::success();
+}
+
+Socket::Segments ClientSession::pendingOutput() {
+    if (!hasPendingOutput()) {
+        refillOutput();
+    }
+
+    if (hasPendingOutput()) {
+        state_ = State::Writing;
+        return std::span<const std::span<const uint8_t>>(outSegments_).subspan(outHead_);
+    }
+
+    if (closeAfterWrite_) {
+        state_ = State::Closed;
+        markInactive();
+    }
+    else {
+        state_ = State::Reading;
+    }
+    return {};
+}
+
+void ClientSession::advanceOutput(size_t sent) {
+    // Drop Fully Written Segments, Trim a Partially Written One
+    while (sent > 0 && hasPendingOutput()) {
+        auto& segment = outSegments_[outHead_];
+        if (sent < segment.size()) {
+            segment = segment.subspan(sent);
+            break;
+        }
+        sent -= segment.size();
+        ++outHead_;
+    }
+}
+
+void ClientSession::refillOutput() {
+    while (!hasPendingOutput()) {
+        outSegments_.clear();
+        outHead_ = 0;
+        outStorage_.clear();
+
+        // The Last Piece May Point Into the Source, so it Goes Only Once Sent
+        if (outputSourceDone_) {
+            outputSource_ = nullptr;
+            outputSourceDone_ = false;
+        }
+
+        // Queue Drained: Pull the Next Piece of a Streamed Body
+        if (!outputSource_) {
+            break;
+        }
+        if (!outputSource_(*this)) {
+            outputSourceDone_ = true;
+        }
+    }
 }
\ No newline at end of file
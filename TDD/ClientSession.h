@@ -3,33 +3,78 @@
 #include "Socket.h"
 #include "BumpMemoryManager.h"
 #include "PMRDeleter.h"
+#include "RequestParser.h"
+#include "RequestArena.h"
+#include "ConnectionBuffer.h"
 #include <memory>
 #include <memory_resource>
 #include <thread>
 #include <chrono>
 #include <atomic>
 #include <functional>
+#include <expected>
+#include <vector>
+#include <span>
+#include <optional>
 
 class ClientSession {
 public:
     using ClientHandlerFunc = std::function<void(ClientSession&)>;
 
-    // Constructor
+    // Pulled for More Output Each Time the Queue Drains; Returns False Once Exhausted
+    using OutputSource = std::function<bool(ClientSession&)>;
+
+    // Server-Defined State of a Request Whose Body is Still Arriving
+    struct PendingRequest {
+        virtual ~PendingRequest() = default;
+    };
+    using PendingRequestPtr = std::unique_ptr<PendingRequest, PMRDeleter<PendingRequest>>;
+
+    // Loop Driving the Session; Work Finished on Another Thread Comes Back
+    // Through it and the Loop Services the Session Again on its Own Thread
+    struct Owner {
+        // Thread-Safe
+        virtual void resume(ClientSession& session) = 0;
+
+    protected:
+        ~Owner() = default;
+    };
+
+    // Free Input Space Asked for Before Each Socket Read
+    static constexpr size_t ReadChunkSize = 16 * 1024;
+
+    // Event-Loop Mode State Machine
+    enum class State {
+        Reading,    // Waiting for Request Bytes
+        Writing,    // Response Queued, Socket Send Buffer Full
+        Closed      // Flushed (or Failed); Owner Should Destroy
+    };
+
+    // Constructor; a Non-Zero requestArenaSize Adds a Request Arena Next to resource
     ClientSession(
         std::shared_ptr<Socket> socket,
         std::unique_ptr<std::pmr::memory_resource, BumpMemoryManager::CustomDeleter> resource,
-        ClientHandlerFunc handler
+        ClientHandlerFunc handler,
+        size_t requestArenaSize = 0
     );
 
     // Destructor
     ~ClientSession();
 
-    // Start
+    // Start Dedicated Thread (Thread-per-Session Mode Only)
     void start();
 
     // Get Session's Memory Resource
     std::pmr::memory_resource* getResource() const;
 
+    // Memory for One Request and its Response (the Session Resource When
+    // There is No Arena). Everything Allocated From it Dies at the Next Reset
+    std::pmr::memory_resource* getRequestResource();
+    // Rewinds the Arena Unless a Body or Output Still Refers to it; True if it Did
+    bool resetRequestArena();
+    // Largest Single Request Footprint so Far (0 Without an Arena)
+    size_t getRequestArenaHighWater() const;
+
     // Get Socket
     std::shared_ptr<Socket> getSocket() const;
 
@@ -39,6 +84,54 @@ public:
     std::chrono::steady_clock::time_point getLastActivityTime() const;
     void updateLastActivityTime();
 
+    // Bytes Received but Not Yet Consumed by a Complete Request; Sockets
+    // Read Straight Into its writable() Space
+    ConnectionBuffer& getInputBuffer();
+    RequestParser& getParser();
+
+    // Set Once a Head is Parsed and Cleared When its Body Ends; Allocate From getResource()
+    PendingRequest* getPendingRequest() const;
+    void setPendingRequest(PendingRequestPtr request);
+    void clearPendingRequest();
+
+    // Set by the Loop That Registers the Session
+    void setOwner(Owner* owner);
+
+    // Request Handed to a Worker (Loop Thread). Until it Returns the Request
+    // Arena Stays Put and the Owner Neither Closes Nor Expires the Session
+    void dispatch(PendingRequestPtr work);
+    bool isDispatched() const;
+    // Worker Thread, Once Done With the Work; the Last Touch of the Session
+    void resume();
+    // Owner's Thread, on Receiving resume()
+    void markReturned();
+    // The Returned Work, Once; nullptr While a Worker Has it (or Without Any)
+    PendingRequestPtr takeReturnedWork();
+
+    // Readiness-Driven I/O (Event-Loop Mode)
+    State getState() const;
+    // Session Takes Ownership; the Buffer is Written in Place, Not Copied
+    void queueOutput(std::pmr::vector<uint8_t>&& data);
+    // Caller Guarantees the Bytes Outlive the Session (Static Storage)
+    void queueStaticOutput(std::span<const uint8_t> data);
+    // Close Once Everything Queued So Far Has Been Written
+    void closeAfterOutput();
+    bool hasPendingOutput() const;
+    // Streamed Body: Consulted Only When Everything Queued Has Been Sent,
+    // so at Most One Piece is Held Beyond the Kernel Send Buffer
+    void setOutputSource(OutputSource source);
+    bool hasOutputSource() const;
+    // Send Until Drained (Source Included) or WouldBlock; Transitions State Accordingly
+    SocketError flushOutput();
+    // Completion-Driven Sends: the Segments to Write Next (Pulling the Source
+    // When the Queue is Empty; Empty Once Drained, With State Updated), Then
+    // How Many Bytes Were Written
+    Socket::Segments pendingOutput();
+    void advanceOutput(size_t sent);
+
+    // Intrusive Link for Lock-Free Completion Queues
+    ClientSession* queueNext = nullptr;
+
     // Deleted Copy/Move Ops
     ClientSession(const ClientSession&) = delete;
     ClientSession& operator=(const ClientSession&) = delete;
@@ -46,13 +139,44 @@ public:
     ClientSession& operator=(ClientSession&&) = delete;
 
 private:
+    // Not Allocator-Aware, so Storing it Always Move-Constructs the Vector
+    // (Keeping its Buffer) Instead of Re-Allocating From the Session Resource
+    struct OwnedBuffer {
+        std::pmr::vector<uint8_t> bytes;
+    };
+
     // Thread Handler Method
     void threadHandler();
 
+    // Queue Empty: Drops Sent Buffers and Pulls the Source Until it Queues Something or Ends
+    void refillOutput();
+
     std::shared_ptr<Socket> socket_;
     std::unique_ptr<std::pmr::memory_resource, BumpMemoryManager::CustomDeleter> resource_;
     std::atomic<bool> active_;
     std::thread thread_;
     std::chrono::steady_clock::time_point lastActivity_;
     ClientHandlerFunc handlerFunc_;
+
+    // Request-Scoped Allocations; Rewound Between Keep-Alive Requests
+    std::optional<RequestArena> requestArena_;
+
+    // Incremental Request Framing
+    ConnectionBuffer inBuffer_;
+    RequestParser parser_;
+    PendingRequestPtr pendingRequest_;
+
+    // Off-Loop Request Handling
+    Owner* owner_;
+    PendingRequestPtr dispatched_;
+    bool dispatchReturned_;
+
+    // Event-Loop Mode Output: Unwritten Segments (Sent Scatter-Gather) and the Buffers Behind Them
+    State state_;
+    std::pmr::vector<std::span<const uint8_t>> outSegments_;
+    size_t outHead_;
+    std::pmr::vector<OwnedBuffer> outStorage_;
+    OutputSource outputSource_;
+    bool outputSourceDone_;     // Returned False; Released Once its Last Piece is Sent
+    bool closeAfterWrite_;
 };
\ No newline at end of file
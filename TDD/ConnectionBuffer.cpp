@@ -0,0 +1,192 @@
+#include "ConnectionBuffer.h"
+#include <algorithm>
+#include <cstring>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+ConnectionBuffer::ConnectionBuffer(std::pmr::memory_resource* resource, size_t initialCapacity, size_t limit)
+    : resource_(resource),
+    initialCapacity_(std::min(initialCapacity, limit)),
+    limit_(limit),
+    head_(0),
+    size_(0),
+    highWater_(0),
+    growths_(0)
+{
+
+}
+
+ConnectionBuffer::~ConnectionBuffer() {
+    releaseRegion(region_);
+}
+
+std::span<const uint8_t> ConnectionBuffer::readable() const {
+    return { region_.data + head_, size_ };
+}
+
+void ConnectionBuffer::consume(size_t count) {
+    count = std::min(count, size_);
+    size_ -= count;
+
+    // Empty: Start Over at the Front, Where the Pages are Warm
+    if (size_ == 0) {
+        head_ = 0;
+        return;
+    }
+
+    head_ += count;
+    if (region_.mirrored && head_ >= region_.capacity) {
+        head_ -= region_.capacity;
+    }
+}
+
+std::span<uint8_t> ConnectionBuffer::writable(size_t minimum) {
+    if (!region_.data) {
+        region_ = allocateRegion(std::max(initialCapacity_, std::min(minimum, limit_)));
+    }
+    if (region_.capacity - size_ < minimum) {
+        grow(size_ + minimum);
+    }
+
+    if (region_.mirrored) {
+        // Free Space Runs Past the End Into the Mirror, so it is One Span
+        size_t tail = head_ + size_;
+        if (tail >= region_.capacity) {
+            tail -= region_.capacity;
+        }
+        return { region_.data + tail, region_.capacity - size_ };
+    }
+
+    // Flat: Slide the Unconsumed Bytes Down When the Tail Alone is Too Short
+    size_t tailSpace = region_.capacity - head_ - size_;
+    if (tailSpace < minimum && head_ > 0) {
+        std::memmove(region_.data, region_.data + head_, size_);
+        head_ = 0;
+    }
+    return { region_.data + head_ + size_, region_.capacity - head_ - size_ };
+}
+
+void ConnectionBuffer::commit(size_t count) {
+    size_ += count;
+    highWater_ = std::max(highWater_, size_);
+}
+
+size_t ConnectionBuffer::size() const {
+    return size_;
+}
+
+bool ConnectionBuffer::empty() const {
+    return size_ == 0;
+}
+
+void ConnectionBuffer::clear() {
+    head_ = 0;
+    size_ = 0;
+}
+
+void ConnectionBuffer::setLimit(size_t limit) {
+    limit_ = limit;
+    initialCapacity_ = std::min(initialCapacity_, limit);
+}
+
+size_t ConnectionBuffer::limit() const {
+    return limit_;
+}
+
+size_t ConnectionBuffer::capacity() const {
+    return region_.capacity;
+}
+
+size_t ConnectionBuffer::highWaterMark() const {
+    return highWater_;
+}
+
+size_t ConnectionBuffer::growthCount() const {
+    return growths_;
+}
+
+bool ConnectionBuffer::isMirrored() const {
+    return region_.mirrored;
+}
+
+ConnectionBuffer::Region ConnectionBuffer::allocateRegion(size_t capacity) {
+    Region region;
+
+#ifdef __linux__
+    // Mirrored Mapping Works in Whole Pages
+    size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t mappedCapacity = (capacity + pageSize - 1) / pageSize * pageSize;
+
+    int fd = capacity >= MirrorThreshold ? memfd_create("ConnectionBuffer", MFD_CLOEXEC) : -1;
+    if (fd >= 0) {
+        capacity = mappedCapacity;
+
+        // Reserve Twice the Size, Then Map the Same Pages Over Both Halves
+        void* reserved = MAP_FAILED;
+        if (ftruncate(fd, static_cast<off_t>(capacity)) == 0) {
+            reserved = mmap(nullptr, 2 * capacity, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        }
+
+        if (reserved != MAP_FAILED) {
+            auto* base = static_cast<uint8_t*>(reserved);
+            bool mapped =
+                mmap(base, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED &&
+                mmap(base + capacity, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED;
+
+            if (mapped) {
+                ::close(fd);
+                region.data = base;
+                region.capacity = capacity;
+                region.mirrored = true;
+                return region;
+            }
+            munmap(reserved, 2 * capacity);
+        }
+        ::close(fd);
+    }
+#endif
+
+    // Flat Fallback From the Session's Resource
+    region.data = static_cast<uint8_t*>(resource_->allocate(capacity, alignof(std::max_align_t)));
+    region.capacity = capacity;
+    return region;
+}
+
+void ConnectionBuffer::releaseRegion(Region& region) {
+    if (!region.data) {
+        return;
+    }
+
+#ifdef __linux__
+    if (region.mirrored) {
+        munmap(region.data, 2 * region.capacity);
+        region = Region{};
+        return;
+    }
+#endif
+
+    resource_->deallocate(region.data, region.capacity, alignof(std::max_align_t));
+    region = Region{};
+}
+
+void ConnectionBuffer::grow(size_t required) {
+    size_t capacity = std::max<size_t>(region_.capacity, 1);
+    while (capacity < required && capacity < limit_) {
+        capacity *= 2;
+    }
+    capacity = std::min(capacity, limit_);
+    if (capacity <= region_.capacity) {
+        return;
+    }
+
+    // Readable Bytes are Contiguous in Either Layout; They Land at the Front
+    Region grown = allocateRegion(capacity);
+    std::memcpy(grown.data, region_.data + head_, size_);
+    releaseRegion(region_);
+    region_ = grown;
+    head_ = 0;
+    ++growths_;
+}
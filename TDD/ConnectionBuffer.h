@@ -0,0 +1,89 @@
+#pragma once
+
+#if !defined(_WIN32)
+#define API
+#elif defined(LIB_EXPORTS)
+#define API __declspec(dllexport)
+#else
+#define API __declspec(dllimport)
+#endif
+
+#include <memory_resource>
+#include <span>
+#include <cstddef>
+#include <cstdint>
+
+// Read Side of a Connection: Received Bytes Waiting to be Parsed
+//
+// A Ring Whose Unconsumed Bytes are Always One Contiguous View. Once it
+// Grows to MirrorThreshold on Linux, the Ring is Mapped Twice Back to Back,
+// so Data Crossing the End Shows Up Again at the Start and Nothing is Ever
+// Moved. Smaller Buffers (Most Connections, Where the Mapping Syscalls Cost
+// More Than They Save), Other Platforms and Failed Mappings Use a Flat
+// Buffer That Slides its Contents Down Only When the Free Tail is Too
+// Short. Grows by Doubling up to limit(). Not Thread-Safe.
+class API ConnectionBuffer {
+public:
+    static constexpr size_t DefaultInitialCapacity = 16 * 1024;
+    static constexpr size_t DefaultLimit = 16 * 1024 * 1024;
+    static constexpr size_t MirrorThreshold = 64 * 1024;
+
+    explicit ConnectionBuffer(
+        std::pmr::memory_resource* resource,
+        size_t initialCapacity = DefaultInitialCapacity,
+        size_t limit = DefaultLimit
+    );
+    ~ConnectionBuffer();
+
+    // Unconsumed Bytes, Oldest First; Valid Until the Next consume() or writable()
+    std::span<const uint8_t> readable() const;
+    void consume(size_t count);
+
+    // Free Space After the Readable Bytes, Grown to at Least minimum When the
+    // Limit Allows; Empty Only When Full at the Limit. Follow With commit()
+    std::span<uint8_t> writable(size_t minimum = 1);
+    void commit(size_t count);
+
+    size_t size() const;
+    bool empty() const;
+    void clear();
+
+    // Applies From the Next Growth; Never Shrinks an Existing Buffer
+    void setLimit(size_t limit);
+    size_t limit() const;
+
+    // Fill Metrics: a Client Holding a Buffer Near its Limit is Slow or Hostile
+    size_t capacity() const;
+    size_t highWaterMark() const;       // Largest size() Ever Reached
+    size_t growthCount() const;
+    bool isMirrored() const;
+
+    // Delete Copy/Move Operations
+    ConnectionBuffer(const ConnectionBuffer&) = delete;
+    ConnectionBuffer& operator=(const ConnectionBuffer&) = delete;
+    ConnectionBuffer(ConnectionBuffer&&) = delete;
+    ConnectionBuffer& operator=(ConnectionBuffer&&) = delete;
+
+private:
+    // Storage of capacity Bytes (Mapped Twice When mirrored)
+    struct Region {
+        uint8_t* data = nullptr;
+        size_t capacity = 0;
+        bool mirrored = false;
+    };
+
+    Region allocateRegion(size_t capacity);
+    void releaseRegion(Region& region);
+    void grow(size_t required);
+
+    std::pmr::memory_resource* resource_;
+    size_t initialCapacity_;
+    size_t limit_;
+
+    Region region_;         // Empty Until the First writable()
+    size_t head_;           // Offset of the First Unconsumed Byte
+    size_t size_;
+
+    size_t highWater_;
+    size_t growths_;
+};
@@ -0,0 +1,129 @@
+#include "EpollEngine.h"
+
+#ifdef __linux__
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+
+namespace {
+    constexpr size_t MaxEventsPerWait = 256;
+}
+
+EpollEngine::EpollEngine()
+    : epollFd_(-1),
+    wakeupFd_(-1) {
+}
+
+EpollEngine::~EpollEngine() {
+    if (wakeupFd_ >= 0) ::close(wakeupFd_);
+    if (epollFd_ >= 0) ::close(epollFd_);
+}
+
+SocketError EpollEngine::init() {
+    if (epollFd_ >= 0) return SocketError::success();
+
+    epollFd_ = epoll_create1(EPOLL_CLOEXEC);
+    if (epollFd_ < 0) {
+        return { SocketError::Type::Initialization, errno };
+    }
+
+    // Wakeup Channel; userData nullptr Marks it Internal
+    wakeupFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeupFd_ < 0) {
+        return { SocketError::Type::Initialization, errno };
+    }
+
+    epoll_event ev{};
+    ev.events = EPOLLIN | EPOLLET;
+    ev.data.ptr = nullptr;
+    if (epoll_ctl(epollFd_, EPOLL_CTL_ADD, wakeupFd_, &ev) < 0) {
+        return { SocketError::Type::Initialization, errno };
+    }
+
+    return SocketError::success();
+}
+
+uint32_t EpollEngine::toEpoll(uint32_t events) {
+    uint32_t result = EPOLLRDHUP;
+    if (events & Readable) result |= EPOLLIN;
+    if (events & Writable) result |= EPOLLOUT;
+    if (events & EdgeTriggered) result |= EPOLLET;
+    if (events & OneShot) result |= EPOLLONESHOT;
+    return result;
+}
+
+uint32_t EpollEngine::fromEpoll(uint32_t events) {
+    uint32_t result = 0;
+    if (events & EPOLLIN) result |= Readable;
+    if (events & EPOLLOUT) result |= Writable;
+    if (events & (EPOLLHUP | EPOLLRDHUP)) result |= HangUp;
+    if (events & EPOLLERR) result |= Error;
+    return result;
+}
+
+SocketError EpollEngine::control(int op, const Socket& socket, uint32_t events, void* userData) {
+    if (epollFd_ < 0) {
+        return { SocketError::Type::Initialization, 0 };
+    }
+
+    epoll_event ev{};
+    ev.events = toEpoll(events);
+    ev.data.ptr = userData;
+    int fd = static_cast<int>(socket.getNativeHandle());
+    if (epoll_ctl(epollFd_, op, fd, op == EPOLL_CTL_DEL ? nullptr : &ev) < 0) {
+        return { SocketError::Type::Poll, errno };
+    }
+
+    return SocketError::success();
+}
+
+SocketError EpollEngine::add(const Socket& socket, uint32_t events, void* userData) {
+    return control(EPOLL_CTL_ADD, socket, events, userData);
+}
+
+SocketError EpollEngine::modify(const Socket& socket, uint32_t events, void* userData) {
+    return control(EPOLL_CTL_MOD, socket, events, userData);
+}
+
+SocketError EpollEngine::remove(const Socket& socket) {
+    return control(EPOLL_CTL_DEL, socket, 0, nullptr);
+}
+
+std::expected<size_t, SocketError> EpollEngine::wait(std::span<IOEvent> events, int timeoutMs) {
+    if (epollFd_ < 0) {
+        return std::unexpected(SocketError{ SocketError::Type::Initialization, 0 });
+    }
+
+    epoll_event raw[MaxEventsPerWait];
+    int maxEvents = static_cast<int>(std::min(events.size(), MaxEventsPerWait));
+
+    int count = epoll_wait(epollFd_, raw, maxEvents, timeoutMs);
+    if (count < 0) {
+        if (errno == EINTR) return 0;
+        return std::unexpected(SocketError{ SocketError::Type::Poll, errno });
+    }
+
+    size_t written = 0;
+    for (int i = 0; i < count; ++i) {
+        // Drain Wakeups Without Reporting Them
+        if (raw[i].data.ptr == nullptr) {
+            uint64_t value;
+            while (::read(wakeupFd_, &value, sizeof(value)) > 0) {}
+            continue;
+        }
+
+        events[written++] = IOEvent{ raw[i].data.ptr, fromEpoll(raw[i].events) };
+    }
+
+    return written;
+}
+
+void EpollEngine::wakeup() {
+    uint64_t one = 1;
+    [[maybe_unused]] auto result = ::write(wakeupFd_, &one, sizeof(one));
+}
+
+#endif
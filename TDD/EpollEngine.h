@@ -0,0 +1,47 @@
+#pragma once
+
+#if !defined(_WIN32)
+#define API
+#elif defined(LIB_EXPORTS)
+#define API __declspec(dllexport)
+#else
+#define API __declspec(dllimport)
+#endif
+
+#ifdef __linux__
+
+#include "IOEngine.h"
+#include <expected>
+#include <span>
+
+class API EpollEngine : public IOEngine {
+public:
+    EpollEngine();
+    ~EpollEngine() override;
+
+    SocketError init() override;
+
+    SocketError add(const Socket& socket, uint32_t events, void* userData) override;
+    SocketError modify(const Socket& socket, uint32_t events, void* userData) override;
+    SocketError remove(const Socket& socket) override;
+
+    std::expected<size_t, SocketError> wait(std::span<IOEvent> events, int timeoutMs) override;
+
+    void wakeup() override;
+
+    // Deleted Copy/Move Ops
+    EpollEngine(const EpollEngine&) = delete;
+    EpollEngine& operator=(const EpollEngine&) = delete;
+    EpollEngine(EpollEngine&&) = delete;
+    EpollEngine& operator=(EpollEngine&&) = delete;
+
+private:
+    static uint32_t toEpoll(uint32_t events);
+    static uint32_t fromEpoll(uint32_t events);
+    SocketError control(int op, const Socket& socket, uint32_t events, void* userData);
+
+    int epollFd_;
+    int wakeupFd_;
+};
+
+#endif
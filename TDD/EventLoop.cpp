@@ -0,0 +1,245 @@
+#include "EventLoop.h"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+    constexpr size_t EventsPerWait = 256;
+    constexpr int WaitTimeoutMs = 1000;
+}
+
+EventLoop::EventLoop(
+    std::unique_ptr<IOEngine> engine,
+    std::pmr::memory_resource* resource,
+    SessionEventHandler handler,
+    std::chrono::seconds idleTimeout
+) :
+    engine_(std::move(engine)),
+    resource_(resource),
+    handler_(std::move(handler)),
+    idleTimeout_(idleTimeout),
+    running_(false),
+    sessions_(resource),
+    sessionCount_(0),
+    lastSweep_(std::chrono::steady_clock::now()),
+    pending_(resource),
+    listener_(nullptr)
+{
+}
+
+EventLoop::~EventLoop() {
+    stop();
+}
+
+void EventLoop::acceptOn(Socket& listener, SessionFactory factory) {
+    listener_ = &listener;
+    factory_ = std::move(factory);
+}
+
+SocketError EventLoop::start() {
+    auto initResult = engine_->init();
+    if (initResult.type != SocketError::Type::None) {
+        return initResult;
+    }
+
+    if (listener_) {
+        listener_->setNonBlocking();
+        auto addResult = engine_->add(*listener_, IOEngine::Readable | IOEngine::EdgeTriggered, listener_);
+        if (addResult.type != SocketError::Type::None) {
+            return addResult;
+        }
+    }
+
+    running_ = true;
+    thread_ = std::thread(&EventLoop::run, this);
+    return SocketError::success();
+}
+
+void EventLoop::stop() {
+    if (!running_.exchange(false)) return;
+
+    engine_->wakeup();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+
+    // Loop Thread Gone; Safe to Tear Down Directly
+    sessions_.clear();
+    sessionCount_ = 0;
+    resumed_.reset();
+
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    pending_.clear();
+}
+
+void EventLoop::adopt(SessionPtr session) {
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        pending_.push_back(std::move(session));
+    }
+    engine_->wakeup();
+}
+
+void EventLoop::resume(ClientSession& session) {
+    // Only the First of a Batch Needs to Interrupt the Wait
+    if (resumed_.push(&session)) {
+        engine_->wakeup();
+    }
+}
+
+size_t EventLoop::getSessionCount() const {
+    return sessionCount_.load(std::memory_order_relaxed);
+}
+
+void EventLoop::registerPending() {
+    std::pmr::vector<SessionPtr> adopted(resource_);
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        adopted.swap(pending_);
+    }
+
+    for (auto& session : adopted) {
+        registerSession(std::move(session));
+    }
+}
+
+void EventLoop::registerSession(SessionPtr session) {
+    auto* raw = session.get();
+
+    // Edge-Triggered Read+Write Interest; ADD Reports Data That Already Arrived
+    auto addResult = engine_->add(*raw->getSocket(),
+        IOEngine::Readable | IOEngine::Writable | IOEngine::EdgeTriggered, raw);
+    if (addResult.type != SocketError::Type::None) {
+        std::cerr << "Failed to register client session: " << addResult.internalCode << std::endl;
+        return;
+    }
+
+    raw->setOwner(this);
+    sessions_.emplace(raw, std::move(session));
+    sessionCount_.store(sessions_.size(), std::memory_order_relaxed);
+}
+
+void EventLoop::acceptPending() {
+    // Edge-Triggered: Drain the Backlog; Other Shards Never Touch it
+    auto drained = drainAccepts(*listener_, running_, [this](std::shared_ptr<Socket> clientSocket) {
+        try {
+            auto session = factory_(std::move(clientSocket));
+            if (session) {
+                registerSession(std::move(session));
+            }
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Failed to create client session: " << e.what() << std::endl;
+        }
+    });
+
+    if (drained == AcceptDrain::Exhausted) {
+        acceptRetryAt_ = std::chrono::steady_clock::now() + AcceptRetryInterval;
+    }
+    else {
+        acceptRetryAt_.reset();
+    }
+}
+
+void EventLoop::resumeSessions() {
+    ClientSession* session = resumed_.drain();
+    while (session) {
+        ClientSession* next = session->queueNext;
+        session->markReturned();
+        serviceSession(session, 0);
+        session = next;
+    }
+}
+
+void EventLoop::serviceSession(ClientSession* session, uint32_t events) {
+    if (session->isActive()) {
+        try {
+            handler_(*session, events);
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Event loop handler exception: " << e.what() << std::endl;
+            session->markInactive();
+        }
+        catch (...) {
+            std::cerr << "Unknown exception in event loop handler" << std::endl;
+            session->markInactive();
+        }
+    }
+
+    if (!session->isActive()) {
+        closeSession(session);
+    }
+}
+
+void EventLoop::closeSession(ClientSession* session) {
+    auto it = sessions_.find(session);
+    if (it == sessions_.end()) return;
+
+    // A Worker Still Holds it: Closed Once the Work Comes Back
+    if (session->isDispatched()) {
+        session->markInactive();
+        return;
+    }
+
+    engine_->remove(*session->getSocket());
+    sessions_.erase(it);
+    sessionCount_.store(sessions_.size(), std::memory_order_relaxed);
+}
+
+void EventLoop::sweepIdleSessions() {
+    auto now = std::chrono::steady_clock::now();
+    if (now - lastSweep_ < std::chrono::seconds(1)) return;
+    lastSweep_ = now;
+
+    std::pmr::vector<ClientSession*> expired(resource_);
+    for (const auto& [raw, session] : sessions_) {
+        if (!raw->isDispatched() && now - raw->getLastActivityTime() > idleTimeout_) {
+            expired.push_back(raw);
+        }
+    }
+
+    for (auto* raw : expired) {
+        closeSession(raw);
+    }
+}
+
+void EventLoop::run() {
+    IOEvent events[EventsPerWait];
+
+    while (running_) {
+        registerPending();
+
+        // Out of Descriptors, Wake for the Accept Retry Even if Nothing Else Happens
+        int timeoutMs = WaitTimeoutMs;
+        if (acceptRetryAt_) {
+            auto remaining = std::chrono::ceil<std::chrono::milliseconds>(*acceptRetryAt_ - std::chrono::steady_clock::now());
+            timeoutMs = static_cast<int>(std::clamp<long long>(remaining.count(), 0, WaitTimeoutMs));
+        }
+
+        auto waitResult = engine_->wait(events, timeoutMs);
+        if (!waitResult.has_value()) {
+            std::cerr << "Event loop wait failed: " << waitResult.error().internalCode << std::endl;
+            break;
+        }
+
+        for (size_t i = 0; i < waitResult.value(); ++i) {
+            if (listener_ && events[i].userData == listener_) {
+                acceptPending();
+                continue;
+            }
+
+            auto* session = static_cast<ClientSession*>(events[i].userData);
+            if (!sessions_.contains(session)) {
+                continue;
+            }
+            serviceSession(session, events[i].events);
+        }
+
+        if (acceptRetryAt_ && std::chrono::steady_clock::now() >= *acceptRetryAt_) {
+            acceptPending();
+        }
+
+        resumeSessions();
+
+        sweepIdleSessions();
+    }
+}
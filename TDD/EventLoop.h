@@ -0,0 +1,101 @@
+#pragma once
+
+#if !defined(_WIN32)
+#define API
+#elif defined(LIB_EXPORTS)
+#define API __declspec(dllexport)
+#else
+#define API __declspec(dllimport)
+#endif
+
+#include "IOEngine.h"
+#include "ClientSession.h"
+#include "MpscQueue.h"
+#include "AcceptDrain.h"
+#include "PMRDeleter.h"
+#include <memory>
+#include <memory_resource>
+#include <unordered_map>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <vector>
+
+// Single Reactor Thread Owning an IOEngine and the Sessions Registered on it
+class API EventLoop : public ClientSession::Owner {
+public:
+    using SessionPtr = std::unique_ptr<ClientSession, PMRDeleter<ClientSession>>;
+    // Invoked on the Loop Thread for Every Readiness Event of a Session, and
+    // With No Events Once Work Dispatched Elsewhere Returns
+    using SessionEventHandler = std::function<void(ClientSession&, uint32_t events)>;
+    // Builds the Session for a Connection the Loop Accepted; nullptr Sheds it
+    using SessionFactory = std::function<SessionPtr(std::shared_ptr<Socket>)>;
+
+    EventLoop(
+        std::unique_ptr<IOEngine> engine,
+        std::pmr::memory_resource* resource,
+        SessionEventHandler handler,
+        std::chrono::seconds idleTimeout = std::chrono::seconds(60)
+    );
+    ~EventLoop();
+
+    // Before start(): Accept From a Listener of This Loop's Own (SO_REUSEPORT
+    // Shard), No Acceptor Thread Involved; the Listener Must Outlive the Loop
+    void acceptOn(Socket& listener, SessionFactory factory);
+
+    SocketError start();
+    void stop();
+
+    // Thread-Safe Hand-Off From the Acceptor
+    void adopt(SessionPtr session);
+
+    // Thread-Safe: a Session's Dispatched Work is Done
+    void resume(ClientSession& session) override;
+
+    size_t getSessionCount() const;
+
+    // Deleted Copy/Move Ops
+    EventLoop(const EventLoop&) = delete;
+    EventLoop& operator=(const EventLoop&) = delete;
+    EventLoop(EventLoop&&) = delete;
+    EventLoop& operator=(EventLoop&&) = delete;
+
+private:
+    void run();
+    void registerPending();
+    void registerSession(SessionPtr session);
+    void acceptPending();
+    void resumeSessions();
+    void serviceSession(ClientSession* session, uint32_t events);
+    void closeSession(ClientSession* session);
+    void sweepIdleSessions();
+
+    std::unique_ptr<IOEngine> engine_;
+    std::pmr::memory_resource* resource_;
+    SessionEventHandler handler_;
+    std::chrono::seconds idleTimeout_;
+
+    std::atomic<bool> running_;
+    std::thread thread_;
+
+    // Owned Exclusively by the Loop Thread
+    std::pmr::unordered_map<ClientSession*, SessionPtr> sessions_;
+    std::atomic<size_t> sessionCount_;
+    std::chrono::steady_clock::time_point lastSweep_;
+
+    // Pending Adoptions
+    std::pmr::vector<SessionPtr> pending_;
+    std::mutex pendingMutex_;
+
+    // Sessions Whose Workers Finished, Linked Through queueNext
+    MpscQueue<ClientSession, &ClientSession::queueNext> resumed_;
+
+    // Own Listener, if Any (Doubles as its Event's userData)
+    Socket* listener_;
+    SessionFactory factory_;
+    // Set While Out of Descriptors: the Backlog is Retried Then, Not on an Edge
+    std::optional<std::chrono::steady_clock::time_point> acceptRetryAt_;
+};
@@ -1,27 +1,106 @@
 #include "HTTPServer.h"
-#include "WinsockSocket.h"
 #include <iostream>
 #include <sstream>
 #include <format>
 #include <algorithm>
+#include <charconv>
+
+namespace {
+    // Upper Bound on How Long Blocked Threads Take to Notice stop()
+    constexpr std::chrono::milliseconds ReadablePollInterval(100);
+
+    // Pre-Encoded Connection Header for Responses That End the Connection
+    constexpr std::string_view CloseHeaders = "Connection: close\r\n";
+
+    // Chunked Framing Around Streamed Response Bodies
+    constexpr std::string_view ChunkedHeader = "Transfer-Encoding: chunked\r\n";
+    constexpr std::string_view ChunkEnd = "\r\n";
+    constexpr std::string_view ChunkEndAndLastChunk = "\r\n0\r\n\r\n";
+    constexpr std::string_view LastChunk = "0\r\n\r\n";
+
+    // Responses Gathered per Send: Status Line, Headers and Body Each Take a Segment
+    constexpr size_t MaxBatchedResponses = Socket::MaxSendSegments / 3;
+
+    HTTPServer::Response internalError(const std::exception& e, std::pmr::memory_resource* resource) {
+        HTTPServer::Response response(500, {}, resource);
+        std::string_view prefix = "Internal Server Error: ";
+        std::string_view what = e.what();
+        response.body.reserve(prefix.size() + what.size());
+        response.body.insert(response.body.end(), prefix.begin(), prefix.end());
+        response.body.insert(response.body.end(), what.begin(), what.end());
+        return response;
+    }
+
+    // Headers the Serializer Always Writes Itself; Handler Copies Would Duplicate Them
+    bool isServerManagedHeader(std::string_view name) {
+        return equalsIgnoreCase(name, "Connection")
+            || equalsIgnoreCase(name, "Keep-Alive")
+            || equalsIgnoreCase(name, "Content-Length")
+            || equalsIgnoreCase(name, "Transfer-Encoding")
+            || equalsIgnoreCase(name, "Date");
+    }
+}
 
 HTTPServer::HTTPServer(
     std::unique_ptr<Socket, PMRDeleter<Socket>> socket,
-    std::shared_ptr<BumpMemoryManager> memoryManager
+    std::shared_ptr<BumpMemoryManager> memoryManager,
+    Config config
 ) :
     socket_(std::move(socket)),
+    acceptEngine_(IOEngine::createDefault()),
     memoryManager_(std::move(memoryManager)),
     serverResource_(memoryManager_->getResource()),
     running_(false),
     handlers_(serverResource_),
     routes_(serverResource_),
+    routeTable_(nullptr),
+    retiredTables_(serverResource_),
+    eventLoops_(serverResource_),
+    nextEventLoop_(0),
+    workers_(nullptr, PMRDeleter<WorkerPool>(serverResource_)),
+    blockingWorkers_(nullptr, PMRDeleter<WorkerPool>(serverResource_)),
+    shardListeners_(serverResource_),
+#ifdef __linux__
+    ioUringLoops_(serverResource_),
+#endif
     clientSessions_(serverResource_),
-    clientSessionBufferSize_(1000 * 1024)  // 256KB per Client by Default
+    reapSignal_(false),
+    config_(config),
+    clientSessionBufferSize_(config.sessionBufferSize),
+    keepAliveHeaders_(serverResource_),
+    requestArenaHighWater_(0)
 {
+    // Encoded Once; Every Keep-Alive Response Copies it Verbatim
+    keepAliveHeaders_ = "Connection: keep-alive\r\nKeep-Alive: timeout=";
+    keepAliveHeaders_ += std::to_string(config_.keepAliveTimeout.count());
+    keepAliveHeaders_ += ", max=100\r\n";
+
+    // Readers Always Find a Table, Even Before the First Route
+    routeTable_.store(buildRouteTable(routes_).release());
+
+#ifndef __linux__
+    if (config_.connectionModel == ConnectionModel::IoUring) {
+        std::cerr << "io_uring is Linux-only; using event loops" << std::endl;
+        config_.connectionModel = ConnectionModel::EventLoop;
+    }
+#endif
+
+    // Event Loops Need a Readiness Engine; Fall Back Where There is None
+    if (config_.connectionModel == ConnectionModel::EventLoop && !acceptEngine_) {
+        std::cerr << "No I/O engine on this platform; using thread-per-session" << std::endl;
+        config_.connectionModel = ConnectionModel::ThreadPerSession;
+    }
 }
 
 HTTPServer::~HTTPServer() {
     stop();
+
+    // No Readers Remain Once Every Thread is Joined
+    PMRDeleter<RouteTable> deleter(serverResource_);
+    deleter(routeTable_.exchange(nullptr));
+    for (auto* retired : retiredTables_) {
+        deleter(retired);
+    }
 }
 
 SocketError HTTPServer::start(const std::pmr::string& address, uint16_t port) {
@@ -30,6 +109,14 @@ SocketError HTTPServer::start(const std::pmr::string& address, uint16_t port) {
         return initResult;
     }
 
+    // Sharded: Every Listener Sets SO_REUSEPORT Before Binding, and the
+    // Kernel Spreads Connections Over Them by Flow Hash
+    bool sharded = config_.shardListeners && config_.connectionModel != ConnectionModel::ThreadPerSession;
+    if (sharded && socket_->setReusePort().type != SocketError::Type::None) {
+        std::cerr << "SO_REUSEPORT unavailable; using one listener" << std::endl;
+        sharded = false;
+    }
+
     auto bindResult = socket_->bind(address, port);
     if (bindResult.type != SocketError::Type::None) {
         return bindResult;
@@ -40,10 +127,59 @@ SocketError HTTPServer::start(const std::pmr::string& address, uint16_t port) {
         return listenResult;
     }
 
+    if (sharded) {
+        auto shardResult = openShardListeners(address, port, reactorCount() - 1);
+        if (shardResult.type != SocketError::Type::None) {
+            return shardResult;
+        }
+    }
+
+    // Before the Loops, so Every Session They Create Sees the Pools
+    if (config_.connectionModel != ConnectionModel::ThreadPerSession) {
+        startWorkerPools();
+    }
+
+    // Completion Loops Accept Themselves, so No Accept Thread or Engine
+    if (config_.connectionModel == ConnectionModel::IoUring) {
+        auto uringResult = startIoUringLoops(sharded);
+        if (uringResult.type == SocketError::Type::None) {
+            running_ = true;
+            return uringResult;
+        }
+        std::cerr << "io_uring unavailable (" << uringResult.internalCode << "); using event loops" << std::endl;
+        config_.connectionModel = ConnectionModel::EventLoop;
+    }
+
+    // Edge-Triggered Listener Readiness Where an Engine Exists; Sharded
+    // Event Loops Watch Their Own Listeners Instead
+    if (acceptEngine_ && !sharded) {
+        auto engineResult = acceptEngine_->init();
+        if (engineResult.type == SocketError::Type::None) {
+            socket_->setNonBlocking();
+            engineResult = acceptEngine_->add(*socket_,
+                IOEngine::Readable | IOEngine::EdgeTriggered, socket_.get());
+        }
+        if (engineResult.type != SocketError::Type::None) {
+            return engineResult;
+        }
+    }
+
+    if (config_.connectionModel == ConnectionModel::EventLoop) {
+        auto loopResult = startEventLoops(sharded);
+        if (loopResult.type != SocketError::Type::None) {
+            return loopResult;
+        }
+    }
+
     running_ = true;
+    if (sharded) {
+        return SocketError::success();
+    }
 
-    // Start Cleanup Thread
-    cleanupThread_ = std::thread(&HTTPServer::cleanupThreadHandler, this);
+    // Start Cleanup Thread (Event Loops Reap Their Own Sessions)
+    if (config_.connectionModel == ConnectionModel::ThreadPerSession) {
+        cleanupThread_ = std::thread(&HTTPServer::cleanupThreadHandler, this);
+    }
 
     // Start accept thread
     acceptThread_ = std::thread(&HTTPServer::acceptThreadHandler, this);
@@ -56,6 +192,13 @@ void HTTPServer::stop() {
 
     running_ = false;
 
+    if (acceptEngine_) {
+        acceptEngine_->wakeup();
+    }
+
+    reapSignal_.store(true);
+    reapSignal_.notify_one();
+
     // Wait Threads
     if (cleanupThread_.joinable()) {
         cleanupThread_.join();
@@ -65,6 +208,38 @@ void HTTPServer::stop() {
         acceptThread_.join();
     }
 
+    // Running Handlers Post Back to Loops Still Alive; Queued Ones are Dropped
+    // and Their Sessions Go With the Loops. Stopped Pools Refuse Further
+    // Work, so the Loops Answer Inline Until They Stop Too
+    if (workers_) {
+        workers_->stop();
+    }
+    if (blockingWorkers_) {
+        blockingWorkers_->stop();
+    }
+
+    // Stop Reactors (Destroys Their Sessions)
+    for (auto& loop : eventLoops_) {
+        loop->stop();
+    }
+    eventLoops_.clear();
+#ifdef __linux__
+    for (auto& loop : ioUringLoops_) {
+        loop->stop();
+    }
+    ioUringLoops_.clear();
+#endif
+
+    // No Loop Reads the Pools Any More
+    workers_.reset();
+    blockingWorkers_.reset();
+
+    // No Loop Watches Them Any More
+    for (auto& listener : shardListeners_) {
+        listener->close();
+    }
+    shardListeners_.clear();
+
     // Final Cleanup of Sessions
     cleanupSessions();
 
@@ -76,15 +251,20 @@ void HTTPServer::stop() {
 void HTTPServer::cleanupSessions() {
     std::lock_guard<std::mutex> lock(clientSessionsMutex_);
 
-    auto it = clientSessions_.begin();
-    while (it != clientSessions_.end()) {
-        auto& session = *it;
-        if (!session->isActive()) {
-            it = clientSessions_.erase(it++);
-        }
-        else {
-            ++it;
-        }
+    // Destroying a Session Joins its Thread; All Observe running_ == false
+    clientSessions_.clear();
+    finishedSessions_.reset();
+}
+
+void HTTPServer::reapFinishedSessions() {
+    ClientSession* finished = finishedSessions_.drain();
+    if (!finished) return;
+
+    std::lock_guard<std::mutex> lock(clientSessionsMutex_);
+    while (finished) {
+        ClientSession* next = finished->queueNext;
+        clientSessions_.erase(finished);
+        finished = next;
     }
 }
 
@@ -97,269 +277,804 @@ void HTTPServer::registerHandlerWithMethods(
     const std::pmr::vector<std::pmr::string>& methods,
     RequestHandler handler
 ) {
-    RouteConfig route(serverResource_);
+    addRoute(path, methods, std::move(handler), nullptr);
+}
+
+void HTTPServer::registerBlockingHandler(
+    const std::pmr::string& path,
+    const std::pmr::vector<std::pmr::string>& methods,
+    RequestHandler handler
+) {
+    addRoute(path, methods, std::move(handler), nullptr, true);
+}
+
+void HTTPServer::registerStreamingHandler(
+    const std::pmr::string& path,
+    const std::pmr::vector<std::pmr::string>& methods,
+    StreamingRequestHandler handler
+) {
+    addRoute(path, methods, nullptr, std::move(handler));
+}
+
+void HTTPServer::addRoute(
+    const std::pmr::string& path,
+    const std::pmr::vector<std::pmr::string>& methods,
+    RequestHandler handler,
+    StreamingRequestHandler streamingHandler,
+    bool blocking
+) {
+    // No Methods Listed Means Every Method
+    HttpMethod::Mask mask = HttpMethod::Any;
+    if (!methods.empty()) {
+        mask = 0;
+        for (const auto& method : methods) {
+            mask |= HttpMethod::fromName(method);
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(routesMutex_);
+
+    // Same Pattern and Methods: Swap the Handler in Place
+    auto existing = std::find_if(routes_.begin(), routes_.end(), [&](const RouteConfig& route) {
+        return route.path == path && route.methods == mask;
+    });
+    if (existing != routes_.end()) {
+        existing->handler = std::move(handler);
+        existing->streamingHandler = std::move(streamingHandler);
+        existing->blocking = blocking;
+        publishRouteTable(lock, buildRouteTable(routes_));
+        return;
+    }
+
+    RouteConfig& route = routes_.emplace_back(serverResource_);
     route.path = path;
     route.allowedMethods = methods;
+    route.methods = mask;
     route.handler = std::move(handler);
-    routes_.push_back(std::move(route));
+    route.streamingHandler = std::move(streamingHandler);
+    route.blocking = blocking;
+
+    auto table = buildRouteTable(routes_);
+    if (!table) {
+        routes_.pop_back();
+        std::cerr << "Rejected route pattern: " << path << std::endl;
+        return;
+    }
+    publishRouteTable(lock, std::move(table));
+}
+
+bool HTTPServer::unregisterHandler(const std::pmr::string& path) {
+    std::unique_lock<std::mutex> lock(routesMutex_);
+
+    auto removed = std::erase_if(routes_, [&](const RouteConfig& route) {
+        return route.path == path;
+    });
+    if (removed == 0) {
+        return false;
+    }
+
+    publishRouteTable(lock, buildRouteTable(routes_));
+    return true;
+}
+
+HTTPServer::RouteTablePtr HTTPServer::buildRouteTable(const std::pmr::vector<RouteConfig>& routes) {
+    auto table = make_pmr_unique_ptr<RouteTable>(serverResource_, serverResource_);
+    table->routes.reserve(routes.size());
+
+    for (const auto& route : routes) {
+        if (!table->router.add(route.path, route.methods, static_cast<uint32_t>(table->routes.size()))) {
+            return RouteTablePtr(nullptr, PMRDeleter<RouteTable>(serverResource_));
+        }
+
+        RouteConfig& copy = table->routes.emplace_back(serverResource_);
+        copy.path = route.path;
+        copy.allowedMethods = route.allowedMethods;
+        copy.methods = route.methods;
+        copy.handler = route.handler;
+        copy.streamingHandler = route.streamingHandler;
+        copy.blocking = route.blocking;
+    }
+    return table;
+}
+
+void HTTPServer::publishRouteTable(std::unique_lock<std::mutex>& lock, RouteTablePtr table) {
+    // Requests Arriving From Here on See the New Table
+    RouteTable* previous = routeTable_.exchange(table.release());
+    retiredTables_.push_back(previous);
+
+    // A Handler Changing Routes Holds a Read Section Itself and Would Wait
+    // Forever; its Retired Tables are Freed by the Next Update or on Shutdown
+    if (RcuDomain::inReadSection()) {
+        return;
+    }
+
+    // Wait Outside the Lock: a Reader Being Waited on May be a Handler
+    // That is Itself Blocked on routesMutex_
+    std::pmr::vector<RouteTable*> reclaim(serverResource_);
+    reclaim.swap(retiredTables_);
+    lock.unlock();
+
+    routeRcu_.synchronize();
+
+    PMRDeleter<RouteTable> deleter(serverResource_);
+    for (auto* retired : reclaim) {
+        deleter(retired);
+    }
+}
+
+HTTPServer::Request::Request(const RequestView& requestView, std::pmr::memory_resource* resource)
+    : method(requestView.method, resource),
+    path(requestView.path, resource),
+    version(requestView.version, resource),
+    headers(resource),
+    body(requestView.body.begin(), requestView.body.end(), resource),
+    params(resource),
+    view(requestView) {
+    for (const auto& header : requestView.headers) {
+        headers.emplace(
+            std::pmr::string(header.name, resource),
+            std::pmr::string(header.value, resource)
+        );
+    }
 }
 
 HTTPServer::Request HTTPServer::parseRequest(
     const std::pmr::vector<uint8_t>& data,
     std::pmr::memory_resource* resource
 ) {
-    Request request(resource);
-    std::pmr::string rawRequest(data.begin(), data.end(), resource);
+    RequestParser parser;
+    if (parser.parse(data) != RequestParser::Status::Complete) {
+        return Request(resource);
+    }
 
-    std::istringstream stream(std::string(rawRequest.begin(), rawRequest.end()));
-    std::pmr::string line(resource);
+    return Request(parser.request(), resource);
+}
 
-    // Parse Request Line
-    if (std::getline(stream, line)) {
-        // Remove \r
-        if (!line.empty() && line.back() == '\r') {
-            line.pop_back();
-        }
+std::array<std::span<const uint8_t>, 3> HTTPServer::SerializedResponse::segments() const {
+    return {
+        std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(statusLine.data()), statusLine.size()),
+        std::span<const uint8_t>(headers),
+        std::span<const uint8_t>(body)
+    };
+}
+
+size_t HTTPServer::SerializedResponse::size() const {
+    return statusLine.size() + headers.size() + body.size();
+}
 
-        std::istringstream lineStream(line);
-        std::string method, path, httpVersion;
-        lineStream >> method >> path >> httpVersion;
+HTTPServer::BodyWriter::BodyWriter(std::pmr::memory_resource* resource)
+    : chunk_(resource) {
+}
+
+void HTTPServer::BodyWriter::write(std::span<const uint8_t> data) {
+    chunk_.insert(chunk_.end(), data.begin(), data.end());
+}
 
-        request.method = std::pmr::string(method, resource);
-        request.path = std::pmr::string(path, resource);
-        request.version = std::pmr::string(httpVersion, resource);
+void HTTPServer::BodyWriter::write(std::string_view text) {
+    chunk_.insert(chunk_.end(), text.begin(), text.end());
+}
+
+size_t HTTPServer::BodyWriter::size() const {
+    return chunk_.size();
+}
+
+std::span<const uint8_t> HTTPServer::BodyWriter::data() const {
+    return chunk_;
+}
+
+void HTTPServer::BodyWriter::clear() {
+    chunk_.clear();
+}
+
+HTTPServer::ResponseStream::ResponseStream(
+    BodyProducer&& bodyProducer,
+    bool chunkedFraming,
+    std::pmr::memory_resource* resource
+) :
+    producer(std::move(bodyProducer)),
+    chunked(chunkedFraming),
+    writer(resource) {
+}
+
+bool HTTPServer::ResponseStream::pull() {
+    writer.clear();
+    sizeLineLength = 0;
+    trailer = {};
+
+    bool more = producer(writer);
+    if (!chunked) {
+        return more;
     }
 
-    // Parse Headers
-    while (std::getline(stream, line)) {
-        // Remove \r
-        if (!line.empty() && line.back() == '\r') {
-            line.pop_back();
-        }
+    // An Empty Write Must Not Emit a Zero-Size Chunk (That Ends the Body)
+    if (writer.size() != 0) {
+        auto [end, ec] = std::to_chars(sizeLine.data(), sizeLine.data() + sizeLine.size() - 2, writer.size(), 16);
+        *end++ = '\r';
+        *end++ = '\n';
+        sizeLineLength = static_cast<size_t>(end - sizeLine.data());
+        trailer = more ? ChunkEnd : ChunkEndAndLastChunk;
+    }
+    else if (!more) {
+        trailer = LastChunk;
+    }
+    return more;
+}
 
-        // Empty Line Signals End of Headers
-        if (line.empty()) {
-            break;
-        }
+std::array<std::span<const uint8_t>, 3> HTTPServer::ResponseStream::segments() const {
+    return {
+        std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(sizeLine.data()), sizeLineLength),
+        writer.data(),
+        std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(trailer.data()), trailer.size())
+    };
+}
 
-        auto colonPos = line.find(':');
-        if (colonPos != std::string::npos) {
-            std::pmr::string key = line.substr(0, colonPos);
-            // Skip Colon and Leading Spaces
-            size_t valueStart = line.find_first_not_of(" \t", colonPos + 1);
-            std::pmr::string value = (valueStart != std::pmr::string::npos) ?
-                line.substr(valueStart) : "";
+SocketError HTTPServer::sendStream(
+    Socket& socket,
+    SerializedResponse& response,
+    std::pmr::memory_resource* resource
+) {
+    ResponseStream stream(std::move(response.producer), response.chunked, resource);
 
-            request.headers[std::pmr::string(key, resource)] =
-                std::pmr::string(value, resource);
+    // Blocking Sends Pace the Producer; One Piece is Held at a Time
+    bool more = true;
+    while (more) {
+        try {
+            more = stream.pull();
+        }
+        catch (const std::exception& e) {
+            // Too Late for a 500; Dropping the Connection Marks the Body Truncated
+            std::cerr << "Response stream failed: " << e.what() << std::endl;
+            return { SocketError::Type::Send, 0 };
+        }
+
+        auto segments = stream.segments();
+        auto sendResult = socket.sendv(segments);
+        if (sendResult.type != SocketError::Type::None) {
+            return sendResult;
         }
     }
+    return SocketError::success();
+}
 
-    // Read Body if Content-Length Present
-    auto contentLength = request.headers.find(std::pmr::string("Content-Length", resource));
-    if (contentLength != request.headers.end()) {
-        size_t length = std::stoul(contentLength->second.c_str());
-        request.body.resize(length, 0);
+ClientSession::OutputSource HTTPServer::makeStreamSource(
+    SerializedResponse& response,
+    std::pmr::memory_resource* resource
+) {
+    auto stream = std::make_shared<ResponseStream>(std::move(response.producer), response.chunked, resource);
 
-        stream.read(reinterpret_cast<char*>(request.body.data()), length);
-    }
+    // Queued Views Stay Valid: the Session Pulls Again Only Once They are Sent
+    return [stream](ClientSession& session) {
+        bool more;
+        try {
+            more = stream->pull();
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Response stream failed: " << e.what() << std::endl;
+            session.closeAfterOutput();
+            return false;
+        }
 
-    return request;
+        for (auto segment : stream->segments()) {
+            session.queueStaticOutput(segment);
+        }
+        return more;
+    };
 }
 
-std::pmr::vector<uint8_t> HTTPServer::serializeResponse(
-    const Response& response,
-    std::pmr::memory_resource* resource
+HTTPServer::SerializedResponse HTTPServer::serializeResponse(
+    Response&& response,
+    std::pmr::memory_resource* resource,
+    bool keepAlive
 ) {
-    std::pmr::string headerString(resource);
+    // Body Travels as its Own Segment
+    SerializedResponse serialized(resource, std::move(response.body));
+    auto& headers = serialized.headers;
+
+    // Streamed: Length Unknown; Chunked Unless the Connection End Delimits it
+    bool streamed = static_cast<bool>(response.producer);
+    if (streamed) {
+        serialized.producer = std::move(response.producer);
+        serialized.chunked = keepAlive;
+
+        // A Pre-Filled Body Must Be Framed Too, so it Becomes the First Piece
+        if (!serialized.body.empty()) {
+            serialized.producer = [first = std::move(serialized.body), rest = std::move(serialized.producer), started = false]
+                (BodyWriter& writer) mutable {
+                if (!started) {
+                    started = true;
+                    writer.write(std::span<const uint8_t>(first));
+                    return true;
+                }
+                return rest(writer);
+            };
+            serialized.body = std::pmr::vector<uint8_t>(resource);
+        }
+    }
+
+    auto append = [&headers](std::string_view text) {
+        headers.insert(headers.end(), text.begin(), text.end());
+    };
+    auto appendNumber = [&headers](auto value) {
+        char digits[20];
+        auto [end, ec] = std::to_chars(digits, digits + sizeof(digits), value);
+        headers.insert(headers.end(), digits, end);
+    };
+
+    // One Allocation for the Whole Header Block
+    size_t headerBytes = HttpDate::HeaderSize + keepAliveHeaders_.size() + 40;
+    for (const auto& [key, value] : response.headers) {
+        headerBytes += key.size() + value.size() + 4;
+    }
+    headers.reserve(headerBytes);
 
     // Status Line
-    headerString += "HTTP/1.1 " + std::to_string(response.statusCode) + " ";
-    switch (response.statusCode) {
-    case 200: headerString += "OK"; break;
-    case 400: headerString += "Bad Request"; break;
-    case 404: headerString += "Not Found"; break;
-    case 405: headerString += "Method Not Allowed"; break;
-    case 500: headerString += "Internal Server Error"; break;
-    default: headerString += "Unknown";
-    }
-    headerString += "\r\n";
-
-    // Headers
+    serialized.statusLine = HttpStatus::statusLine(response.statusCode);
+    if (serialized.statusLine.empty()) {
+        append("HTTP/1.1 ");
+        appendNumber(response.statusCode);
+        append(" Unknown\r\n");
+    }
+
+    // Pre-Formatted Fragments
+    append(HttpDate::header());
+    append(keepAlive ? std::string_view(keepAliveHeaders_) : CloseHeaders);
+
+    // Handler Headers
     for (const auto& [key, value] : response.headers) {
-        headerString += std::pmr::string(key.begin(), key.end(), resource);
-        headerString += ": ";
-        headerString += std::pmr::string(value.begin(), value.end(), resource);
-        headerString += "\r\n";
+        if (isServerManagedHeader(key)) continue;
+        append(key);
+        append(": ");
+        append(value);
+        append("\r\n");
     }
 
     // Content-Length Header
-    headerString += "Content-Length: " + std::to_string(response.body.size()) + "\r\n";
+    if (!streamed) {
+        append("Content-Length: ");
+        appendNumber(serialized.body.size());
+        append("\r\n");
+    }
+    else if (serialized.chunked) {
+        append(ChunkedHeader);
+    }
+
+    // Empty Line to Separate Headers from Body
+    append("\r\n");
+
+    return serialized;
+}
+
+const HTTPServer::RouteConfig* HTTPServer::findMatchingRoute(
+    const RouteTable& table,
+    std::string_view path,
+    std::string_view method,
+    Router::Match& match
+) const {
+    // Route on the Path Alone; the Handler Still Sees the Full Target
+    path = path.substr(0, path.find('?'));
 
-    // Empty Line to Separate HJeaders from Body
-    headerString += "\r\n";
+    match = table.router.find(path, HttpMethod::fromName(method));
+    return match.found ? &table.routes[match.routeId] : nullptr;
+}
+
+std::optional<HTTPServer::SerializedResponse> HTTPServer::processNextRequest(
+    ClientSession& session,
+    size_t& offset,
+    bool& keepAlive
+) {
+    auto& input = session.getInputBuffer();
+    auto& parser = session.getParser();
+
+    // Body of an Earlier Head Still Arriving
+    if (session.getPendingRequest()) {
+        return continueBody(session, offset, keepAlive);
+    }
+
+    // Requests Before offset Were Already Answered in This Batch
+    auto data = input.readable().subspan(offset);
+    auto status = parser.parseHead(data);
+
+    // Streaming Routes Take Every Body Piece by Piece, However Much Has
+    // Arrived; Chunked Bodies are Decoded Incrementally Either Way
+    if (status == RequestParser::Status::Complete) {
+        if (!parser.streamingRoute()) {
+            parser.setStreamingRoute(isStreamingRoute(parser.request()));
+        }
+        if (parser.chunked() || *parser.streamingRoute()) {
+            return beginBody(session, offset, keepAlive);
+        }
+    }
+
+    if (status == RequestParser::Status::Complete) {
+        status = parser.parse(data);
+    }
+    if (status == RequestParser::Status::Incomplete) {
+        return std::nullopt;
+    }
 
-    // Create Response Data with Headers
-    std::pmr::vector<uint8_t> responseData(headerString.begin(), headerString.end(), resource);
+    // Malformed: Answer and Drop the Connection (Framing is Lost)
+    if (status == RequestParser::Status::Error) {
+        Response response(parser.errorStatus(), {}, session.getRequestResource());
+        keepAlive = false;
 
-    // Append Body
-    responseData.insert(responseData.end(), response.body.begin(), response.body.end());
+        offset = input.size();
+        parser.reset();
+        return serializeResponse(std::move(response), session.getRequestResource(), keepAlive);
+    }
+
+    // Off to a Worker: Later Requests Wait Until its Response is Queued
+    if (offloadRequest(session, parser.request())) {
+        offset += parser.consumed();
+        parser.reset();
+        return std::nullopt;
+    }
+
+    auto responseData = processRequest(session, parser.request(), keepAlive);
 
+    // Caller Drops Consumed Bytes Once per Batch; Views Stay Valid Until Then
+    offset += parser.consumed();
+    parser.reset();
     return responseData;
 }
 
-bool HTTPServer::isMethodAllowed(
-    const std::pmr::vector<std::pmr::string>& allowedMethods,
-    const std::pmr::string& method
-) const {
-    if (allowedMethods.empty()) {
-        return true;  // All Methods Allowed
+SocketError HTTPServer::sendResponses(Socket& socket, std::span<const SerializedResponse> responses) {
+    std::array<std::span<const uint8_t>, Socket::MaxSendSegments> segments;
+    size_t count = 0;
+    for (const auto& response : responses) {
+        for (auto segment : response.segments()) {
+            if (!segment.empty()) {
+                segments[count++] = segment;
+            }
+        }
     }
+    return socket.sendv(std::span<const std::span<const uint8_t>>(segments.data(), count));
+}
 
-    return std::find(allowedMethods.begin(), allowedMethods.end(), method) != allowedMethods.end();
+HTTPServer::Response HTTPServer::invokeHandler(
+    const RequestHandler& handler,
+    const Request& request,
+    std::pmr::memory_resource* resource
+) {
+    try {
+        return handler(request);
+    }
+    catch (const std::exception& e) {
+        return internalError(e, resource);
+    }
 }
 
-std::optional<HTTPServer::RouteConfig> HTTPServer::findMatchingRoute(
-    const std::pmr::string& path,
-    const std::pmr::string& method
+HTTPServer::SerializedResponse HTTPServer::processRequest(
+    ClientSession& session,
+    const RequestView& view,
+    bool& keepAlive
 ) {
-    for (const auto& route : routes_) {
-        if (route.path == path && isMethodAllowed(route.allowedMethods, method)) {
-            return route;
+    // Materialize Owning Request for Handlers
+    Request request(view, session.getRequestResource());
+
+    // Connection Handling
+    keepAlive = view.keepAlive();
+
+    return dispatchRequest(session, request, keepAlive);
+}
+
+HTTPServer::SerializedResponse HTTPServer::dispatchRequest(
+    ClientSession& session,
+    Request& request,
+    bool& keepAlive
+) {
+    auto* requestResource = session.getRequestResource();
+
+    // Responses are Emplaced (Never Assigned) so Handler Bodies Keep Their Buffers
+    std::optional<Response> response;
+
+    // Pin the Route Snapshot Until the Handler Returns
+    RcuDomain::ReadGuard routesGuard(routeRcu_);
+    const RouteTable& routeTable = *routeTable_.load();
+
+    // Find Matching Route
+    Router::Match match;
+    auto matchingRoute = findMatchingRoute(routeTable, request.path, request.method, match);
+    if (matchingRoute) {
+        for (size_t i = 0; i < match.paramCount; ++i) {
+            request.params.emplace(
+                std::pmr::string(match.params[i].name, requestResource),
+                std::pmr::string(match.params[i].value, requestResource)
+            );
+        }
+
+        if (matchingRoute->streamingHandler) {
+            // Body Arrived Whole: Hand it Over as a Single Run
+            response.emplace(invokeHandler([&](const Request& current) {
+                auto stream = matchingRoute->streamingHandler(current);
+                if (stream.onData && !current.body.empty()) {
+                    stream.onData(current.body);
+                }
+                return stream.onComplete ? stream.onComplete() : Response(200, {}, requestResource);
+            }, request, requestResource));
+        }
+        else {
+            response.emplace(invokeHandler(matchingRoute->handler, request, requestResource));
         }
     }
-    return std::nullopt;
+    else {
+        if (match.pathMethods != 0) {
+            // Method Not Allowed
+            response.emplace(405, std::pmr::unordered_map<std::pmr::string, std::pmr::string>{}, requestResource);
+            response->headers[std::pmr::string("Allow", requestResource)] =
+                HttpMethod::toAllowList(match.pathMethods, requestResource);
+        }
+        else {
+            // Not Found
+            response.emplace(404, std::pmr::unordered_map<std::pmr::string, std::pmr::string>{}, requestResource);
+            std::pmr::string notFoundMsg("Resource Not Found", requestResource);
+            response->body = std::pmr::vector<uint8_t>(
+                notFoundMsg.begin(), notFoundMsg.end(), requestResource
+            );
+        }
+    }
+
+    // Check for Handlers in Legacy Map (Compatibility)
+    auto handlerIt = handlers_.find(request.path);
+    if (handlerIt != handlers_.end()) {
+        response.emplace(invokeHandler(handlerIt->second, request, requestResource));
+    }
+
+    // HTTP/1.0 Has No Chunked Coding: the Connection End Delimits a Stream
+    if (response->producer && request.version != "HTTP/1.1") {
+        keepAlive = false;
+    }
+
+    // Serialize Response
+    return serializeResponse(std::move(*response), requestResource, keepAlive);
+}
+
+HTTPServer::BodyInProgress::BodyInProgress(const RequestView& view, std::pmr::memory_resource* resource)
+    : request(view, resource),
+    headerViews(resource),
+    keepAlive(view.keepAlive()) {
+    // The Input Bytes Behind view are Dropped as the Body is Consumed
+    detachView(request, headerViews);
+}
+
+HTTPServer::DispatchedRequest::DispatchedRequest(const RequestView& view, std::pmr::memory_resource* resource)
+    : request(view, resource),
+    headerViews(resource),
+    keepAlive(view.keepAlive()) {
+    // The Loop Keeps Reading Into the Input While the Worker Runs
+    detachView(request, headerViews);
+}
+
+void HTTPServer::detachView(Request& request, std::pmr::vector<HeaderView>& headerViews) {
+    headerViews.reserve(request.headers.size());
+    for (const auto& [name, value] : request.headers) {
+        headerViews.push_back(HeaderView{ name, value });
+    }
+    request.view.method = request.method;
+    request.view.path = request.path;
+    request.view.version = request.version;
+    request.view.headers = std::span<const HeaderView>(headerViews);
+    request.view.body = std::string_view(reinterpret_cast<const char*>(request.body.data()), request.body.size());
+}
+
+bool HTTPServer::isStreamingRoute(const RequestView& view) {
+    RcuDomain::ReadGuard routesGuard(routeRcu_);
+    Router::Match match;
+    auto route = findMatchingRoute(*routeTable_.load(), view.path, view.method, match);
+    return route && route->streamingHandler;
+}
+
+HTTPServer::SerializedResponse HTTPServer::abortBody(
+    ClientSession& session,
+    Response&& response,
+    size_t& offset,
+    bool& keepAlive
+) {
+    // Rest of the Body is Never Read, so the Connection Cannot be Reused
+    session.clearPendingRequest();
+    session.getParser().reset();
+    offset = session.getInputBuffer().size();
+    keepAlive = false;
+    return serializeResponse(std::move(response), session.getRequestResource(), keepAlive);
+}
+
+std::optional<HTTPServer::SerializedResponse> HTTPServer::beginBody(
+    ClientSession& session,
+    size_t& offset,
+    bool& keepAlive
+) {
+    auto& parser = session.getParser();
+    auto* requestResource = session.getRequestResource();
+
+    auto pending = make_pmr_unique_ptr<BodyInProgress>(requestResource, parser.request(), requestResource);
+    if (parser.chunked()) {
+        pending->decoder.resetChunked();
+    }
+    else {
+        pending->decoder.resetLength(parser.consumed() - parser.headSize());
+    }
+
+    offset += parser.headSize();
+    parser.reset();
+
+    // Streaming Routes Get Their Consumer Before Any Body Byte
+    {
+        RcuDomain::ReadGuard routesGuard(routeRcu_);
+        Router::Match match;
+        auto route = findMatchingRoute(*routeTable_.load(), pending->request.path, pending->request.method, match);
+        if (route && route->streamingHandler) {
+            for (size_t i = 0; i < match.paramCount; ++i) {
+                pending->request.params.emplace(
+                    std::pmr::string(match.params[i].name, requestResource),
+                    std::pmr::string(match.params[i].value, requestResource)
+                );
+            }
+
+            try {
+                pending->stream.emplace(route->streamingHandler(pending->request));
+            }
+            catch (const std::exception& e) {
+                return abortBody(session, internalError(e, requestResource), offset, keepAlive);
+            }
+        }
+    }
+
+    session.setPendingRequest(std::move(pending));
+    return continueBody(session, offset, keepAlive);
+}
+
+std::optional<HTTPServer::SerializedResponse> HTTPServer::continueBody(
+    ClientSession& session,
+    size_t& offset,
+    bool& keepAlive
+) {
+    auto* pending = static_cast<BodyInProgress*>(session.getPendingRequest());
+    auto* requestResource = session.getRequestResource();
+    auto& input = session.getInputBuffer();
+
+    while (true) {
+        std::span<const uint8_t> data;
+        size_t used = 0;
+        auto status = pending->decoder.decode(input.readable().subspan(offset), data, used);
+        offset += used;
+
+        if (status == BodyDecoder::Status::Incomplete) {
+            return std::nullopt;
+        }
+        if (status == BodyDecoder::Status::Error) {
+            return abortBody(session, Response(400, {}, requestResource), offset, keepAlive);
+        }
+        if (status == BodyDecoder::Status::Done) {
+            break;
+        }
+
+        if (pending->stream) {
+            if (!pending->stream->onData) continue;
+            try {
+                pending->stream->onData(data);
+            }
+            catch (const std::exception& e) {
+                return abortBody(session, internalError(e, requestResource), offset, keepAlive);
+            }
+        }
+        else {
+            // Buffered Chunked Bodies Obey the Parser's Cap Like Content-Length Ones
+            auto& body = pending->request.body;
+            if (!session.getParser().bodyFits(body.size() + data.size())) {
+                return abortBody(session, Response(413, {}, requestResource), offset, keepAlive);
+            }
+            body.insert(body.end(), data.begin(), data.end());
+        }
+    }
+
+    keepAlive = pending->keepAlive;
+
+    std::optional<SerializedResponse> responseData;
+    if (pending->stream) {
+        auto& stream = *pending->stream;
+        Response response = invokeHandler([&](const Request&) {
+            return stream.onComplete ? stream.onComplete() : Response(200, {}, requestResource);
+        }, pending->request, requestResource);
+        if (response.producer && pending->request.version != "HTTP/1.1") {
+            keepAlive = false;
+        }
+        responseData.emplace(serializeResponse(std::move(response), requestResource, keepAlive));
+    }
+    else {
+        auto& request = pending->request;
+        request.view.body = std::string_view(reinterpret_cast<const char*>(request.body.data()), request.body.size());
+        responseData.emplace(dispatchRequest(session, request, keepAlive));
+    }
+
+    session.clearPendingRequest();
+    return responseData;
 }
 
 void HTTPServer::handleClient(ClientSession& session) {
-    auto* sessionResource = session.getResource();
     auto clientSocket = session.getSocket();
 
+    // Outlives Every Request, so it Comes From the Session, Not the Request Arena
+    std::pmr::vector<SerializedResponse> batch(session.getResource());
+    batch.reserve(MaxBatchedResponses);
+
     while (running_ && session.isActive()) {
         try {
-             // Attempt to Receive Data
-            auto receiveResult = clientSocket->receive(16384);
+            // Block Until Data Arrives; Timeout Only Re-Checks running_
+            auto readable = clientSocket->waitReadable(ReadablePollInterval);
+            if (!readable.has_value()) {
+                break;
+            }
+            if (!readable.value()) {
+                continue;
+            }
+
+            // Receive Straight Into the Session's Input Buffer; No Room Left
+            // Means a Request Outgrew the Limit Without Completing
+            auto& input = session.getInputBuffer();
+            auto space = input.writable(ClientSession::ReadChunkSize);
+            if (space.empty()) {
+                break;
+            }
+            auto receiveResult = clientSocket->receiveInto(space);
 
-            // No Data Available
+            // Spurious Wakeup Continues; Real Errors End the Session
             if (!receiveResult.has_value()) {
-                std::this_thread::sleep_for(std::chrono::microseconds(10));
-                continue;
+                if (receiveResult.error().type == SocketError::Type::WouldBlock) {
+                    continue;
+                }
+                break;
             }
 
             // Connection Closed
-            if (receiveResult.value().empty()) {
+            if (receiveResult.value() == 0) {
                 break;
             }
 
             // Update TS
             session.updateLastActivityTime();
 
-            // Parse and Process Request
-            auto request = parseRequest(receiveResult.value(), sessionResource);
+            // A Request May Span Reads or Share One With Others
+            input.commit(receiveResult.value());
 
-            // Prepare Default 405 Response
-            Response response(405, {}, sessionResource);
+            // Answer Every Complete Request in Order; Responses Leave in Batches
+            // of One sendmsg() Each Instead of One Send per Pipelined Request
+            bool keepAlive = true;
+            bool sendFailed = false;
+            size_t offset = 0;
 
-            // Find Matching Route
-            auto matchingRoute = findMatchingRoute(request.path, request.method);
-            if (matchingRoute) {
-                try {
-                    response = matchingRoute->handler(request);
-                }
-                catch (const std::exception& e) {
-                    response.statusCode = 500;
-                    std::string error = "Internal Server Error: ";
-                    error += e.what();
-                    std::pmr::string pmrError(error, sessionResource);
-                    response.body = std::pmr::vector<uint8_t>(
-                        pmrError.begin(), pmrError.end(), sessionResource
-                    );
-                }
-            }
-            else {
-                bool pathExists = false;
-                std::pmr::string allowedMethods(sessionResource);
-
-                for (const auto& route : routes_) {
-                    if (route.path == request.path) {
-                        pathExists = true;
-                        for (const auto& method : route.allowedMethods) {
-                            if (!allowedMethods.empty()) allowedMethods += ", ";
-                            allowedMethods += method;
-                        }
-                        break;
-                    }
+            while (keepAlive && !sendFailed) {
+                auto responseData = processNextRequest(session, offset, keepAlive);
+                bool streamed = responseData && responseData->producer;
+                if (responseData) {
+                    batch.push_back(std::move(*responseData));
                 }
 
-                if (pathExists) {
-                    // Method Not Allowed
-                    response.statusCode = 405;
-                    response.headers[std::pmr::string("Allow", sessionResource)] = allowedMethods;
-                }
-                else {
-                    // Not Found
-                    response.statusCode = 404;
-                    std::pmr::string notFoundMsg("Resource Not Found", sessionResource);
-                    response.body = std::pmr::vector<uint8_t>(
-                        notFoundMsg.begin(), notFoundMsg.end(), sessionResource
-                    );
-                }
-            }
+                bool flush = !batch.empty() &&
+                    (!responseData || !keepAlive || streamed || batch.size() == MaxBatchedResponses);
+                if (flush) {
+                    sendFailed = sendResponses(*clientSocket, batch).type != SocketError::Type::None;
 
-            // Check for Handlers in Legacy Map (Compatibility)
-            auto handlerIt = handlers_.find(request.path);
-            if (handlerIt != handlers_.end()) {
-                try {
-                    response = handlerIt->second(request);
-                }
-                catch (const std::exception& e) {
-                    response.statusCode = 500;
-                    std::string error = "Internal Server Error: ";
-                    error += e.what();
-                    std::pmr::string pmrError(error, sessionResource);
-                    response.body = std::pmr::vector<uint8_t>(
-                        pmrError.begin(), pmrError.end(), sessionResource
-                    );
+                    // Streamed Body Follows its Head Before Any Later Response
+                    if (streamed && !sendFailed) {
+                        sendFailed = sendStream(*clientSocket, batch.back(), session.getRequestResource()).type != SocketError::Type::None;
+                    }
+                    batch.clear();
                 }
-            }
-
-            // Connection Handling
-            bool keepAlive = false;
-            auto connectionHeader = request.headers.find(std::pmr::string("Connection", sessionResource));
-            if (connectionHeader != request.headers.end()) {
-                std::pmr::string connectionValue = connectionHeader->second;
-                std::transform(connectionValue.begin(), connectionValue.end(),
-                    connectionValue.begin(), ::tolower);
 
-                // Check "keep-alive" Explicitly
-                keepAlive = (connectionValue == "keep-alive");
-            }
-            else {
-                // Default Behavior
-                // For HTTP/1.1, default is keep-alive
-                // For HTTP/1.0, default is close
-                keepAlive = request.version == "HTTP/1.1";
-            }
-
-            // Set Connection Headers
-            if (keepAlive) {
-                response.headers[std::pmr::string("Connection", sessionResource)] =
-                    std::pmr::string("keep-alive", sessionResource);
-                response.headers[std::pmr::string("Keep-Alive", sessionResource)] =
-                    std::pmr::string("timeout=60, max=100", sessionResource);
-            }
-            else {
-                response.headers[std::pmr::string("Connection", sessionResource)] =
-                    std::pmr::string("close", sessionResource);
+                if (!responseData) {
+                    break;
+                }
             }
 
-            // Serialize and Send Response
-            auto responseData = serializeResponse(response, sessionResource);
-            auto sendResult = clientSocket->send(responseData);
+            // Partial Trailing Request Stays for the Next Read
+            input.consume(offset);
 
-            if (sendResult.type != SocketError::Type::None || !keepAlive) {
+            if (sendFailed || !keepAlive) {
                 break;
             }
+
+            // Every Answered Request is Gone: Rewind Unless a Body is Mid-Read
+            batch.clear();
+            endRequestScope(session);
         }
         catch (const std::exception& e) {
             std::cerr << "Client handler exception: " << e.what() << std::endl;
@@ -372,39 +1087,409 @@ void HTTPServer::handleClient(ClientSession& session) {
     }
 
     session.markInactive();
+
+    // Hand to the Reaper; Only the Empty -> Non-Empty Transition Needs a Wakeup
+    if (finishedSessions_.push(&session)) {
+        reapSignal_.store(true);
+        reapSignal_.notify_one();
+    }
+}
+
+void HTTPServer::onSessionEvent(ClientSession& session, uint32_t events) {
+    if (events & IOEngine::Error) {
+        session.markInactive();
+        return;
+    }
+
+    // Back From a Worker: its Response Goes Out Before Anything Read Since
+    if (finishDispatched(session) && session.isActive() &&
+        session.getState() == ClientSession::State::Reading) {
+        session.flushOutput();
+        endRequestScope(session);
+    }
+
+    // Drain Output Queued While the Send Buffer Was Full
+    if (session.getState() == ClientSession::State::Writing) {
+        if (!(events & IOEngine::Writable)) {
+            return;
+        }
+        session.flushOutput();
+        endRequestScope(session);
+    }
+
+    // Back to Reading (Possibly After a Flush): Edge Was Consumed, so Read Now
+    if (session.getState() == ClientSession::State::Reading) {
+        readAvailable(session);
+    }
+}
+
+void HTTPServer::readAvailable(ClientSession& session) {
+    auto clientSocket = session.getSocket();
+    auto& input = session.getInputBuffer();
+
+    // Requests Held Back Behind a Streamed Response are Answered Before Reading
+    bool buffered = !input.empty();
+
+    while (session.isActive() && session.getState() == ClientSession::State::Reading) {
+        if (!buffered) {
+            auto space = input.writable(ClientSession::ReadChunkSize);
+            if (space.empty()) {
+                session.markInactive();
+                return;
+            }
+            auto receiveResult = clientSocket->receiveInto(space);
+
+            if (!receiveResult.has_value()) {
+                // Drained Until the Next Edge
+                if (receiveResult.error().type != SocketError::Type::WouldBlock) {
+                    session.markInactive();
+                }
+                return;
+            }
+
+            // Connection Closed
+            if (receiveResult.value() == 0) {
+                session.markInactive();
+                return;
+            }
+
+            session.updateLastActivityTime();
+            input.commit(receiveResult.value());
+        }
+        buffered = answerRequests(session);
+
+        // Stays in Writing (and Stops Reading) if the Client is Slow to Drain
+        session.flushOutput();
+        endRequestScope(session);
+    }
+}
+
+bool HTTPServer::answerRequests(ClientSession& session) {
+    // Requests Behind One a Worker Has Wait, so Responses Stay in Order
+    if (session.isDispatched()) {
+        return false;
+    }
+
+    bool keepAlive = true;
+    bool stream = false;
+    size_t offset = 0;
+    while (keepAlive) {
+        auto responseData = processNextRequest(session, offset, keepAlive);
+        if (!responseData) {
+            break;
+        }
+
+        // Later Pipelined Requests Wait Until the Stream Ends
+        if (queueResponse(session, *responseData, keepAlive)) {
+            stream = true;
+            break;
+        }
+    }
+    session.getInputBuffer().consume(offset);
+    return stream;
+}
+
+bool HTTPServer::queueResponse(ClientSession& session, SerializedResponse& response, bool keepAlive) {
+    session.queueStaticOutput(std::span<const uint8_t>(
+        reinterpret_cast<const uint8_t*>(response.statusLine.data()), response.statusLine.size()));
+    session.queueOutput(std::move(response.headers));
+    session.queueOutput(std::move(response.body));
+    if (!keepAlive) {
+        session.closeAfterOutput();
+    }
+
+    if (response.producer) {
+        session.setOutputSource(makeStreamSource(response, session.getRequestResource()));
+        return true;
+    }
+    return false;
+}
+
+bool HTTPServer::offloadRequest(ClientSession& session, const RequestView& view) {
+    if ((!workers_ && !blockingWorkers_) || !running_) {
+        return false;
+    }
+
+    // Only Plain Routes; Streaming, Unmatched and Legacy Ones Stay Inline
+    WorkerPool* pool = nullptr;
+    {
+        RcuDomain::ReadGuard routesGuard(routeRcu_);
+        Router::Match match;
+        auto route = findMatchingRoute(*routeTable_.load(), view.path, view.method, match);
+        if (!route || route->streamingHandler) {
+            return false;
+        }
+        pool = route->blocking && blockingWorkers_ ? blockingWorkers_.get() : workers_.get();
+    }
+    if (!pool) {
+        return false;
+    }
+
+    auto* requestResource = session.getRequestResource();
+    auto work = make_pmr_unique_ptr<DispatchedRequest>(requestResource, view, requestResource);
+    auto* dispatched = work.get();
+    session.dispatch(std::move(work));
+
+    // The Worker Touches Only the Request Arena, Which Stays Put Until the
+    // Loop Has Taken the Response Back
+    bool submitted = pool->submit([this, &session, dispatched] {
+        try {
+            bool keepAlive = dispatched->keepAlive;
+            dispatched->response.emplace(dispatchRequest(session, dispatched->request, keepAlive));
+            dispatched->keepAlive = keepAlive;
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Dispatched request failed: " << e.what() << std::endl;
+        }
+        session.resume();
+    });
+
+    // Pool Already Stopping: Take the Work Back and Answer Inline
+    if (!submitted) {
+        session.markReturned();
+        session.takeReturnedWork();
+        return false;
+    }
+    return true;
+}
+
+bool HTTPServer::finishDispatched(ClientSession& session) {
+    auto work = session.takeReturnedWork();
+    if (!work) {
+        return false;
+    }
+
+    auto& dispatched = static_cast<DispatchedRequest&>(*work);
+    if (!dispatched.response) {
+        session.markInactive();
+        return true;
+    }
+
+    queueResponse(session, *dispatched.response, dispatched.keepAlive);
+    return true;
+}
+
+bool HTTPServer::onSessionCompletion(ClientSession& session) {
+    // Returned Work First; a Streamed Response Holds Back the Rest as in answerRequests()
+    bool returned = finishDispatched(session);
+    endRequestScope(session);
+    if (!session.isActive()) {
+        return false;
+    }
+    if (returned && session.hasOutputSource()) {
+        return true;
+    }
+    return answerRequests(session);
+}
+
+void HTTPServer::endRequestScope(ClientSession& session) {
+    if (!session.resetRequestArena()) {
+        return;
+    }
+
+    // Rarely Grows, so the Common Case is One Relaxed Load
+    size_t highWater = session.getRequestArenaHighWater();
+    size_t current = requestArenaHighWater_.load(std::memory_order_relaxed);
+    while (highWater > current &&
+        !requestArenaHighWater_.compare_exchange_weak(current, highWater, std::memory_order_relaxed)) {
+    }
+}
+
+size_t HTTPServer::inputBufferLimit() const {
+    if (config_.inputBufferLimit > 0) {
+        return config_.inputBufferLimit;
+    }
+
+    // The Parser Rejects Anything Bigger Before the Buffer Fills
+    return RequestParser::MaxHeaderBytes + config_.maxRequestBodySize + ClientSession::ReadChunkSize;
+}
+
+size_t HTTPServer::getRequestArenaHighWater() const {
+    return requestArenaHighWater_.load(std::memory_order_relaxed);
+}
+
+size_t HTTPServer::reactorCount() const {
+    // One Reactor per Core Unless Configured Otherwise
+    if (config_.eventLoopCount > 0) {
+        return config_.eventLoopCount;
+    }
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+SocketError HTTPServer::openShardListeners(const std::pmr::string& address, uint16_t port, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        auto listener = socket_->createSibling();
+
+        auto result = listener->init();
+        if (result.type == SocketError::Type::None) {
+            result = listener->setReusePort();
+        }
+        if (result.type == SocketError::Type::None) {
+            result = listener->bind(address, port);
+        }
+        if (result.type == SocketError::Type::None) {
+            result = listener->listen(100);
+        }
+        if (result.type != SocketError::Type::None) {
+            shardListeners_.clear();
+            return result;
+        }
+        shardListeners_.push_back(std::move(listener));
+    }
+    return SocketError::success();
+}
+
+Socket& HTTPServer::listenerFor(size_t reactor) {
+    return reactor == 0 ? *socket_ : *shardListeners_[reactor - 1];
+}
+
+void HTTPServer::startWorkerPools() {
+    if (config_.workerCount > 0) {
+        workers_ = make_pmr_unique_ptr<WorkerPool>(serverResource_, config_.workerCount, serverResource_);
+        workers_->start();
+    }
+    if (config_.blockingWorkerCount > 0) {
+        blockingWorkers_ = make_pmr_unique_ptr<WorkerPool>(serverResource_, config_.blockingWorkerCount, serverResource_);
+        blockingWorkers_->start();
+    }
+}
+
+SocketError HTTPServer::startEventLoops(bool sharded) {
+    size_t loopCount = reactorCount();
+    for (size_t i = 0; i < loopCount; ++i) {
+        auto loop = make_pmr_unique_ptr<EventLoop>(
+            serverResource_,
+            IOEngine::createDefault(),
+            serverResource_,
+            [this](ClientSession& session, uint32_t events) { this->onSessionEvent(session, events); },
+            config_.keepAliveTimeout
+        );
+
+        // Each Loop Accepts and Owns its Connections; Nothing is Shared
+        if (sharded) {
+            loop->acceptOn(listenerFor(i),
+                [this](std::shared_ptr<Socket> clientSocket) { return this->createSession(std::move(clientSocket), nullptr); });
+        }
+
+        auto loopResult = loop->start();
+        if (loopResult.type != SocketError::Type::None) {
+            eventLoops_.clear();
+            return loopResult;
+        }
+        eventLoops_.push_back(std::move(loop));
+    }
+    return SocketError::success();
+}
+
+SocketError HTTPServer::startIoUringLoops(bool sharded) {
+#ifdef __linux__
+    size_t loopCount = reactorCount();
+
+    IoUringLoop::Config loopConfig;
+    loopConfig.ring.sqPoll = config_.ioUringSqPoll;
+    loopConfig.idleTimeout = config_.keepAliveTimeout;
+
+    std::pmr::vector<IoUringLoop*> peers(serverResource_);
+    for (size_t i = 0; i < loopCount; ++i) {
+        ioUringLoops_.push_back(make_pmr_unique_ptr<IoUringLoop>(
+            serverResource_,
+            serverResource_,
+            [this](std::shared_ptr<Socket> clientSocket) { return this->createSession(std::move(clientSocket), nullptr); },
+            [this](ClientSession& session) { return this->onSessionCompletion(session); },
+            loopConfig
+        ));
+        peers.push_back(ioUringLoops_.back().get());
+    }
+
+    // Sharded: a Multishot Accept per Loop on its Own Listener. Otherwise
+    // One Deals Connections Round-Robin; Accepts Armed in Every Loop on a
+    // Shared Listener Would Mostly Wake the First. The Acceptor Starts Last
+    // and, Being First in the List, Stops First
+    if (sharded) {
+        for (size_t i = 0; i < loopCount; ++i) {
+            ioUringLoops_[i]->acceptOn(listenerFor(i), {});
+        }
+    }
+    else {
+        ioUringLoops_.front()->acceptOn(*socket_, peers);
+    }
+    for (size_t i = loopCount; i-- > 0;) {
+        auto loopResult = ioUringLoops_[i]->start();
+        if (loopResult.type != SocketError::Type::None) {
+            for (auto& loop : ioUringLoops_) {
+                loop->stop();
+            }
+            ioUringLoops_.clear();
+            return loopResult;
+        }
+    }
+    return SocketError::success();
+#else
+    return { SocketError::Type::Initialization, 0 };
+#endif
 }
 
 void HTTPServer::acceptThreadHandler() {
-    if (auto* winsockSocket = dynamic_cast<WinsockSocket*>(socket_.get())) {
-        winsockSocket->setTimeout();
-        winsockSocket->setNonBlocking();
+    if (!acceptEngine_) {
+        socket_->setTimeout();
+        socket_->setNonBlocking();
+
+        while (running_) {
+            auto readable = socket_->waitReadable(ReadablePollInterval);
+            if (readable.has_value() && readable.value() &&
+                acceptPendingClients() == AcceptDrain::Exhausted) {
+                // Still Readable, so Waiting Again Would Return at Once
+                std::this_thread::sleep_for(AcceptRetryInterval);
+            }
+        }
+        return;
     }
 
+    IOEvent events[1];
+    int timeoutMs = -1;
     while (running_) {
-        auto clientResult = socket_->accept();
+        auto waitResult = acceptEngine_->wait(events, timeoutMs);
+        if (!waitResult.has_value()) {
+            std::cerr << "Accept engine wait failed: " << waitResult.error().internalCode << std::endl;
+            break;
+        }
 
         if (!running_) {
             break;
         }
 
-        if (!clientResult.has_value()) {
-            continue;
+        // Edge-Triggered: Drain Every Pending Connection. Out of Descriptors,
+        // the Rest of the Backlog Gets No New Edge, so Retry it on a Timer
+        if (waitResult.value() > 0 || timeoutMs >= 0) {
+            bool exhausted = acceptPendingClients() == AcceptDrain::Exhausted;
+            timeoutMs = exhausted ? static_cast<int>(AcceptRetryInterval.count()) : -1;
         }
+    }
+}
 
-        auto clientSocket = clientResult.value();
-
-        std::lock_guard<std::mutex> lock(clientSessionsMutex_);
+AcceptDrain HTTPServer::acceptPendingClients() {
+    return drainAccepts(*socket_, running_, [this](std::shared_ptr<Socket> clientSocket) {
         try {
-            auto clientResource = memoryManager_->createClientResource(clientSessionBufferSize_);
-            auto session = make_pmr_unique_ptr<ClientSession>(
-                memoryManager_->getResource(),
-                clientSocket,
-                std::move(clientResource),
-                [this](ClientSession& session) { this->handleClient(session); }
-            );
+            if (!eventLoops_.empty()) {
+                // Readiness-Driven: No Thread, Hand to Next Reactor
+                auto session = createSession(clientSocket, nullptr);
+                if (session) {
+                    auto& loop = eventLoops_[nextEventLoop_++ % eventLoops_.size()];
+                    loop->adopt(std::move(session));
+                }
+                return;
+            }
 
-            clientSessions_.push_back(std::move(session));
-            clientSessions_.back()->start();
+            auto session = createSession(clientSocket,
+                [this](ClientSession& session) { this->handleClient(session); });
+            if (!session) {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(clientSessionsMutex_);
+            auto* raw = session.get();
+            clientSessions_.emplace(raw, std::move(session));
+            raw->start();
         }
         catch (const std::exception& e) {
             std::cerr << "Failed to create client session: " << e.what() << std::endl;
@@ -412,12 +1497,40 @@ void HTTPServer::acceptThreadHandler() {
         catch (...) {
             std::cerr << "Unknown error creating client session" << std::endl;
         }
+    });
+}
+
+EventLoop::SessionPtr HTTPServer::createSession(
+    std::shared_ptr<Socket> clientSocket,
+    ClientSession::ClientHandlerFunc handler
+) {
+    // Handlers on a Worker Allocate Alongside the Loop Thread
+    bool offloaded = workers_ || blockingWorkers_;
+    auto clientResource = memoryManager_->createClientResource(clientSessionBufferSize_, offloaded);
+
+    // Session Arenas Exhausted and Overflow Rejects: Shed the Connection
+    if (!clientResource) {
+        clientSocket->close();
+        return EventLoop::SessionPtr(nullptr, PMRDeleter<ClientSession>(memoryManager_->getResource()));
     }
+
+    auto session = make_pmr_unique_ptr<ClientSession>(
+        memoryManager_->getResource(),
+        clientSocket,
+        std::move(clientResource),
+        std::move(handler),
+        config_.requestArenaSize
+    );
+    session->getParser().setMaxBodySize(config_.maxRequestBodySize);
+    session->getInputBuffer().setLimit(inputBufferLimit());
+    return session;
 }
 
 void HTTPServer::cleanupThreadHandler() {
     while (running_) {
-        std::this_thread::sleep_for(std::chrono::microseconds(10));
-        cleanupSessions();
+        // Sleep Until a Session Finishes (or stop() Signals)
+        reapSignal_.wait(false);
+        reapSignal_.store(false);
+        reapFinishedSessions();
     }
 }
\ No newline at end of file
@@ -1,14 +1,29 @@
 // HTTPServer.h
 #pragma once
 
-#ifdef LIB_EXPORTS
+#if !defined(_WIN32)
+#define API
+#elif defined(LIB_EXPORTS)
 #define API __declspec(dllexport)
 #else
 #define API __declspec(dllimport)
 #endif
 
 #include "Socket.h"
+#include "IOEngine.h"
+#include "EventLoop.h"
+#include "IoUringLoop.h"
+#include "WorkerPool.h"
 #include "ClientSession.h"
+#include "MpscQueue.h"
+#include "AcceptDrain.h"
+#include "RequestParser.h"
+#include "BodyDecoder.h"
+#include "HttpStatus.h"
+#include "HttpDate.h"
+#include "Router.h"
+#include "Rcu.h"
+#include "RpcMethod.h"
 #include "BumpMemoryManager.h"
 #include "PMRDeleter.h"
 #include <memory>
@@ -21,15 +36,42 @@
 #include <mutex>
 #include <format>
 #include <iostream>
+#ifdef _WIN32
 #include <winsock2.h>
 #include <ws2tcpip.h>
+#endif
 #include <chrono>
 #include <climits>
 #include <cstdlib>
 #include <algorithm>
+#include <array>
+#include <span>
+#include <string_view>
+
+enum class ConnectionModel {
+    ThreadPerSession,   // Dedicated Thread per ClientSession
+    EventLoop,          // N Reactors Driving Sessions by Readiness Events
+    IoUring             // N Completion-Driven io_uring Reactors (Linux; Else EventLoop)
+};
+
+struct API HTTPServerConfig {
+    ConnectionModel connectionModel = ConnectionModel::ThreadPerSession;
+    size_t eventLoopCount = 0;                    // 0 = One per Hardware Thread
+    size_t sessionBufferSize = 1000 * 1024;       // Per-Client Arena Size
+    size_t requestArenaSize = 64 * 1024;          // Per-Client, Rewound After Each Response (0 = Off)
+    std::chrono::seconds keepAliveTimeout{ 60 };  // Idle Reaping (Event Loops)
+    size_t maxRequestBodySize = RequestParser::DefaultMaxBodyBytes;  // Larger Bodies Get 413
+    size_t inputBufferLimit = 0;                  // Per-Client Read Buffer Cap (0 = Largest Head + Body)
+    bool ioUringSqPoll = false;                   // io_uring Model: a Kernel Thread per Loop Polls Submissions
+    bool shardListeners = false;                  // Loop Models: One SO_REUSEPORT Listener per Loop, No Shared Acceptor
+    size_t workerCount = 0;                       // Loop Models: Handler Threads, e.g. One per Core (0 = Inline on the Loop)
+    size_t blockingWorkerCount = 0;               // Loop Models: Threads for Blocking Routes (0 = With the Others)
+};
 
 class API HTTPServer {
 public:
+    using Config = HTTPServerConfig;
+
     struct Request {
         std::pmr::string method;
         std::pmr::string path;
@@ -37,17 +79,50 @@ public:
         std::pmr::unordered_map<std::pmr::string, std::pmr::string> headers;
         std::pmr::vector<uint8_t> body;
 
+        // Values Captured by "{name}" / "*name" Segments of the Matched Route
+        std::pmr::unordered_map<std::pmr::string, std::pmr::string> params;
+
+        // Zero-Copy Form of the Same Request (Valid During the Handler Call)
+        RequestView view;
+
         Request(std::pmr::memory_resource* resource)
-            : method(resource), path(resource),
-            headers(resource), body(resource) {
+            : method(resource), path(resource), version(resource),
+            headers(resource), body(resource), params(resource) {
         }
+
+        Request(const RequestView& requestView, std::pmr::memory_resource* resource);
     };
 
+    // Collects the Bytes a BodyProducer Emits During One Call
+    class BodyWriter {
+    public:
+        explicit BodyWriter(std::pmr::memory_resource* resource);
+
+        void write(std::span<const uint8_t> data);
+        void write(std::string_view text);
+
+        size_t size() const;
+        std::span<const uint8_t> data() const;
+        void clear();
+
+    private:
+        std::pmr::vector<uint8_t> chunk_;
+    };
+
+    // Streamed Response Body, Pulled One Piece at a Time. The Server Calls it
+    // Only Once Everything Written Before Has Left for the Socket, so Output
+    // Never Runs Ahead of the Client. Returns False After Writing the Last Bytes
+    using BodyProducer = std::function<bool(BodyWriter&)>;
+
     struct Response {
         int statusCode;
         std::pmr::unordered_map<std::pmr::string, std::pmr::string> headers;
         std::pmr::vector<uint8_t> body;
 
+        // Set to Stream the Body (Chunked on Keep-Alive Connections, Otherwise
+        // Delimited by Close); Anything Already in body is Sent First
+        BodyProducer producer;
+
         Response(int code = 200,
             std::pmr::unordered_map<std::pmr::string, std::pmr::string> headers = {},
             std::pmr::memory_resource* resource = std::pmr::get_default_resource())
@@ -55,12 +130,52 @@ public:
         }
     };
 
+    // Wire Form of a Response, Kept as Separate Segments for Scatter-Gather Send
+    struct SerializedResponse {
+        std::string_view statusLine;        // Static Storage; Empty if Folded Into headers
+        std::pmr::vector<uint8_t> headers;  // Header Fields and the Terminating Blank Line
+        std::pmr::vector<uint8_t> body;     // Moved From the Handler's Response, Never Copied
+
+        // Set: the Body Continues From producer After These Segments
+        BodyProducer producer;
+        bool chunked = false;
+
+        SerializedResponse(std::pmr::memory_resource* resource)
+            : headers(resource), body(resource) {
+        }
+
+        // Move-Constructs the Body so its Buffer (and Resource) are Adopted As-Is
+        SerializedResponse(std::pmr::memory_resource* resource, std::pmr::vector<uint8_t>&& responseBody)
+            : headers(resource), body(std::move(responseBody)) {
+        }
+
+        std::array<std::span<const uint8_t>, 3> segments() const;
+        size_t size() const;
+    };
+
     using RequestHandler = std::function<Response(const Request&)>;
 
+    // Body Consumer a Streaming Handler Returns Once the Head Has Arrived
+    struct BodyStream {
+        // Each Run of Body Bytes as it is Received (Chunk Framing Removed);
+        // the View Points Into the Receive Buffer and Dies When the Call Returns
+        std::function<void(std::span<const uint8_t>)> onData;
+        // After the Last Byte; Produces the Response
+        std::function<Response()> onComplete;
+    };
+
+    // Called With the Head Only; the Body is Delivered Through the Returned
+    // BodyStream, so Uploads are Never Buffered Whole in the Session Arena.
+    // The Request Stays Valid Until onComplete Returns
+    using StreamingRequestHandler = std::function<BodyStream(const Request&)>;
+
     struct RouteConfig {
         std::pmr::string path;
         std::pmr::vector<std::pmr::string> allowedMethods;
+        HttpMethod::Mask methods = HttpMethod::Any;
         RequestHandler handler;
+        StreamingRequestHandler streamingHandler;   // Set Instead of handler for Streaming Routes
+        bool blocking = false;                      // Sleeps or Waits on I/O: Kept Off the Compute Workers
 
         RouteConfig(std::pmr::memory_resource* resource)
             : path(resource), allowedMethods(resource) {
@@ -69,32 +184,180 @@ public:
 
     HTTPServer(
         std::unique_ptr<Socket, PMRDeleter<Socket>> socket,
-        std::shared_ptr<BumpMemoryManager> memoryManager
+        std::shared_ptr<BumpMemoryManager> memoryManager,
+        Config config = Config()
     );
     ~HTTPServer();
 
     SocketError start(const std::pmr::string& address, uint16_t port);
     void stop();
 
+    // Safe While Running: Each Change Publishes a New Route Snapshot Without
+    // Pausing Traffic. Re-Registering a Path With the Same Methods Replaces
+    // its Handler; Requests Already in a Handler Finish on the Old Snapshot
     void registerHandler(const std::pmr::string& path, RequestHandler handler);
     void registerHandlerWithMethods(const std::pmr::string& path,
         const std::pmr::vector<std::pmr::string>& methods,
         RequestHandler handler);
-    
+
+    // For Handlers That Block (Sleep, Wait on I/O). With blockingWorkerCount
+    // Set They Run on Their Own Threads, so They Never Hold Up the Others
+    void registerBlockingHandler(const std::pmr::string& path,
+        const std::pmr::vector<std::pmr::string>& methods,
+        RequestHandler handler);
+
+    void registerStreamingHandler(const std::pmr::string& path,
+        const std::pmr::vector<std::pmr::string>& methods,
+        StreamingRequestHandler handler);
+
+    // Typed POST Endpoint: the Body Unpacks Into Req and the Returned Resp
+    // Goes Back as application/msgpack. A Body That Does Not Decode Gets 400
+    template<MsgPackObject Req, MsgPackObject Resp, class Fn>
+    void registerRpc(const std::pmr::string& path, Fn fn) {
+        std::pmr::vector<std::pmr::string> methods(serverResource_);
+        methods.emplace_back("POST");
+
+        registerHandlerWithMethods(path, methods, [fn = std::move(fn)](const Request& request) mutable {
+            auto* resource = request.method.get_allocator().resource();
+            Response response(200, {}, resource);
+            if (invokeRpc<Req, Resp>(fn, request.body, response.body) != RpcStatus::Ok) {
+                response.statusCode = 400;
+                response.body.clear();
+                return response;
+            }
+            response.headers[std::pmr::string("Content-Type", resource)] = std::pmr::string("application/msgpack", resource);
+            return response;
+        });
+    }
+
+    // Removes Every Route Registered Under path; False if There Were None
+    bool unregisterHandler(const std::pmr::string& path);
+
+    // Most Request-Arena Bytes Any One Request Has Used (Overflow Included);
+    // Above requestArenaSize Means Requests Spill to the Session Pool
+    size_t getRequestArenaHighWater() const;
+
 private:
+    // Microbenchmarks Drive the Parse/Route/Serialize Stages Without Sockets
+    friend struct HTTPServerAccess;
+
+    // Immutable Routing Snapshot; Replaced Whole, Never Modified in Place
+    struct RouteTable {
+        std::pmr::vector<RouteConfig> routes;
+        Router router;      // Pattern -> Index Into routes
+
+        RouteTable(std::pmr::memory_resource* resource)
+            : routes(resource), router(resource) {
+        }
+    };
+
+    using RouteTablePtr = std::unique_ptr<RouteTable, PMRDeleter<RouteTable>>;
+
+    // Request Whose Body is Decoded Across Reads: Chunked, or Bound for a Streaming Route
+    struct BodyInProgress : ClientSession::PendingRequest {
+        Request request;                            // Head Copied Out of the Input Buffer
+        std::pmr::vector<HeaderView> headerViews;   // Backs request.view.headers
+        BodyDecoder decoder;
+        std::optional<BodyStream> stream;           // Unset: Buffer Into request.body
+        bool keepAlive;
+
+        BodyInProgress(const RequestView& view, std::pmr::memory_resource* resource);
+    };
+
+    // Complete Request Whose Handler Runs on a Worker; the Response Comes
+    // Back Through the Session's Owner
+    struct DispatchedRequest : ClientSession::PendingRequest {
+        Request request;                            // Copied Out of the Input Buffer
+        std::pmr::vector<HeaderView> headerViews;   // Backs request.view.headers
+        bool keepAlive;
+        std::optional<SerializedResponse> response; // Unset if the Worker Failed
+
+        DispatchedRequest(const RequestView& view, std::pmr::memory_resource* resource);
+    };
+
+    // Chunk Framing Around a Handler's BodyProducer. The Writer's Buffer is
+    // Reused for Every Piece, so a Stream Allocates Once, Not per Chunk
+    struct ResponseStream {
+        BodyProducer producer;
+        bool chunked;
+        BodyWriter writer;
+        std::array<char, 20> sizeLine{};
+        size_t sizeLineLength = 0;
+        std::string_view trailer;
+
+        ResponseStream(BodyProducer&& bodyProducer, bool chunkedFraming, std::pmr::memory_resource* resource);
+
+        // Runs the Producer Once (Exceptions Propagate; Headers Are Already Out).
+        // Returns False After the Last Piece
+        bool pull();
+
+        // Valid Until the Next pull()
+        std::array<std::span<const uint8_t>, 3> segments() const;
+    };
+
+    SocketError sendStream(Socket& socket, SerializedResponse& response, std::pmr::memory_resource* resource);
+    ClientSession::OutputSource makeStreamSource(SerializedResponse& response, std::pmr::memory_resource* resource);
+
+    void addRoute(const std::pmr::string& path,
+        const std::pmr::vector<std::pmr::string>& methods,
+        RequestHandler handler,
+        StreamingRequestHandler streamingHandler,
+        bool blocking = false);
+
+    RouteTablePtr buildRouteTable(const std::pmr::vector<RouteConfig>& routes);
+    // Swaps the Table in and Reclaims Retired Ones; Releases lock Before Waiting
+    void publishRouteTable(std::unique_lock<std::mutex>& lock, RouteTablePtr table);
+
     void handleClient(ClientSession& session);
+    std::optional<SerializedResponse> processNextRequest(ClientSession& session, size_t& offset, bool& keepAlive);
+    SocketError sendResponses(Socket& socket, std::span<const SerializedResponse> responses);
+    SerializedResponse processRequest(ClientSession& session, const RequestView& view, bool& keepAlive);
+    SerializedResponse dispatchRequest(ClientSession& session, Request& request, bool& keepAlive);
+    bool isStreamingRoute(const RequestView& view);
+    // Points request.view at the Request's Own Copies Instead of the Input
+    static void detachView(Request& request, std::pmr::vector<HeaderView>& headerViews);
+    // Queues the Request to a Worker When its Route Runs Off the Loop
+    bool offloadRequest(ClientSession& session, const RequestView& view);
+    // Queues the Response of Returned Work; False if None Has Returned
+    bool finishDispatched(ClientSession& session);
+    // True if the Response Streams (Later Requests Wait for its End)
+    bool queueResponse(ClientSession& session, SerializedResponse& response, bool keepAlive);
+    void startWorkerPools();
+    std::optional<SerializedResponse> beginBody(ClientSession& session, size_t& offset, bool& keepAlive);
+    std::optional<SerializedResponse> continueBody(ClientSession& session, size_t& offset, bool& keepAlive);
+    SerializedResponse abortBody(ClientSession& session, Response&& response, size_t& offset, bool& keepAlive);
+    Response invokeHandler(const RequestHandler& handler, const Request& request, std::pmr::memory_resource* resource);
+    void onSessionEvent(ClientSession& session, uint32_t events);
+    void readAvailable(ClientSession& session);
+    // Queues Responses to the Complete Requests in the Input Buffer; True if
+    // it Stopped Behind a Streamed Response With More Possibly Buffered
+    bool answerRequests(ClientSession& session);
+    bool onSessionCompletion(ClientSession& session);
+    // Rewinds the Session's Request Arena Once Nothing Refers to it
+    void endRequestScope(ClientSession& session);
+    size_t inputBufferLimit() const;
     void cleanupSessions();
+    void reapFinishedSessions();
     Request parseRequest(const std::pmr::vector<uint8_t>& data, std::pmr::memory_resource* resource);
-    std::pmr::vector<uint8_t> serializeResponse(const Response& response, std::pmr::memory_resource* resource);
-    std::optional<RouteConfig> findMatchingRoute(const std::pmr::string& path, const std::pmr::string& method);
-    bool isMethodAllowed(const std::pmr::vector<std::pmr::string>& allowedMethods, const std::pmr::string& method) const;
+    SerializedResponse serializeResponse(Response&& response, std::pmr::memory_resource* resource, bool keepAlive);
+    const RouteConfig* findMatchingRoute(const RouteTable& table, std::string_view path, std::string_view method, Router::Match& match) const;
 
+    size_t reactorCount() const;
+    // SO_REUSEPORT Siblings of socket_, One per Reactor After the First
+    SocketError openShardListeners(const std::pmr::string& address, uint16_t port, size_t count);
+    Socket& listenerFor(size_t reactor);
+    SocketError startEventLoops(bool sharded);
+    SocketError startIoUringLoops(bool sharded);
     void acceptThreadHandler();
+    AcceptDrain acceptPendingClients();
+    // nullptr When Session Arenas are Exhausted and Overflow Rejects
+    EventLoop::SessionPtr createSession(std::shared_ptr<Socket> clientSocket, ClientSession::ClientHandlerFunc handler);
     void cleanupThreadHandler();
 
     // Server State
     std::atomic<bool> running_;
     std::unique_ptr<Socket, PMRDeleter<Socket>> socket_;
+    std::unique_ptr<IOEngine> acceptEngine_;
 
     // Memory Management
     std::shared_ptr<BumpMemoryManager> memoryManager_;
@@ -102,16 +365,48 @@ private:
 
     // Route Config
     std::pmr::unordered_map<std::pmr::string, RequestHandler> handlers_;
-    std::pmr::vector<RouteConfig> routes_;
+    std::pmr::vector<RouteConfig> routes_;          // Writer-Side Source of Truth
+    std::mutex routesMutex_;                        // Serializes Writers Only
+
+    // Readers Load the Current Snapshot Inside an RCU Read Section
+    std::atomic<RouteTable*> routeTable_;
+    RcuDomain routeRcu_;
+    std::pmr::vector<RouteTable*> retiredTables_;   // Unpublished, Awaiting a Grace Period
 
     // Threading
     std::thread acceptThread_;
     std::thread cleanupThread_;
 
+    // Event-Loop Mode
+    std::pmr::vector<std::unique_ptr<EventLoop, PMRDeleter<EventLoop>>> eventLoops_;
+    size_t nextEventLoop_;
+
+    // Handlers Run Off the Loop Threads When Configured
+    std::unique_ptr<WorkerPool, PMRDeleter<WorkerPool>> workers_;
+    std::unique_ptr<WorkerPool, PMRDeleter<WorkerPool>> blockingWorkers_;
+
+    // SO_REUSEPORT Listeners Beyond socket_, One per Further Loop When Sharded
+    std::pmr::vector<std::shared_ptr<Socket>> shardListeners_;
+
+#ifdef __linux__
+    // io_uring Mode: the First Loop Accepts for All, or Each for Itself When Sharded
+    std::pmr::vector<std::unique_ptr<IoUringLoop, PMRDeleter<IoUringLoop>>> ioUringLoops_;
+#endif
+
     // Client Session Management
-    std::pmr::vector<std::unique_ptr<ClientSession, PMRDeleter<ClientSession>>> clientSessions_;
+    std::pmr::unordered_map<ClientSession*, std::unique_ptr<ClientSession, PMRDeleter<ClientSession>>> clientSessions_;
     std::mutex clientSessionsMutex_;
 
+    // Finished Sessions Awaiting Reaping (Pushed by Their Own Threads)
+    MpscQueue<ClientSession, &ClientSession::queueNext> finishedSessions_;
+    std::atomic<bool> reapSignal_;
+
     // Configuration
+    Config config_;
     size_t clientSessionBufferSize_;
+
+    // "Connection: keep-alive" Plus Keep-Alive Timeout, Encoded From config_
+    std::pmr::string keepAliveHeaders_;
+
+    std::atomic<size_t> requestArenaHighWater_;
 };
\ No newline at end of file
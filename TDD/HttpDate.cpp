@@ -0,0 +1,66 @@
+#include "HttpDate.h"
+
+namespace {
+    constexpr const char* DayNames[] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+    constexpr const char* MonthNames[] = {
+        "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
+    };
+
+    char* writeText(char* out, const char* text, size_t length) {
+        for (size_t i = 0; i < length; ++i) {
+            *out++ = text[i];
+        }
+        return out;
+    }
+
+    char* writeTwoDigits(char* out, int value) {
+        *out++ = static_cast<char>('0' + value / 10);
+        *out++ = static_cast<char>('0' + value % 10);
+        return out;
+    }
+
+    struct CachedHeader {
+        std::time_t second = -1;
+        char text[HttpDate::HeaderSize];
+    };
+}
+
+void HttpDate::format(std::time_t time, char* out) {
+    std::tm utc{};
+#ifdef _WIN32
+    gmtime_s(&utc, &time);
+#else
+    gmtime_r(&time, &utc);
+#endif
+
+    int year = utc.tm_year + 1900;
+
+    out = writeText(out, "Date: ", 6);
+    out = writeText(out, DayNames[utc.tm_wday], 3);
+    out = writeText(out, ", ", 2);
+    out = writeTwoDigits(out, utc.tm_mday);
+    *out++ = ' ';
+    out = writeText(out, MonthNames[utc.tm_mon], 3);
+    *out++ = ' ';
+    out = writeTwoDigits(out, year / 100);
+    out = writeTwoDigits(out, year % 100);
+    *out++ = ' ';
+    out = writeTwoDigits(out, utc.tm_hour);
+    *out++ = ':';
+    out = writeTwoDigits(out, utc.tm_min);
+    *out++ = ':';
+    out = writeTwoDigits(out, utc.tm_sec);
+    out = writeText(out, " GMT\r\n", 6);
+}
+
+std::string_view HttpDate::header() {
+    // Per-Thread Copy: No Locking, and a Reader Never Sees a Half-Written Refresh
+    thread_local CachedHeader cached;
+
+    std::time_t now = std::time(nullptr);
+    if (now != cached.second) {
+        format(now, cached.text);
+        cached.second = now;
+    }
+    return std::string_view(cached.text, HeaderSize);
+}
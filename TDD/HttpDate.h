@@ -0,0 +1,26 @@
+#pragma once
+
+#if !defined(_WIN32)
+#define API
+#elif defined(LIB_EXPORTS)
+#define API __declspec(dllexport)
+#else
+#define API __declspec(dllimport)
+#endif
+
+#include <string_view>
+#include <ctime>
+#include <cstddef>
+
+// Pre-Formatted Date Header (RFC 9110 IMF-fixdate)
+class API HttpDate {
+public:
+    // "Date: Sun, 06 Nov 1994 08:49:37 GMT\r\n"
+    static constexpr size_t HeaderSize = 37;
+
+    // Header for the Current Second; Each Thread Re-Formats at Most Once per Second
+    static std::string_view header();
+
+    // Writes Exactly HeaderSize Bytes
+    static void format(std::time_t time, char* out);
+};
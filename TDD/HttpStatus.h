@@ -0,0 +1,143 @@
+#pragma once
+
+#include <array>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+// Compile-Time Table of Complete HTTP/1.1 Status Lines
+//
+// Every Registered Code Maps to its Pre-Encoded "HTTP/1.1 NNN Reason\r\n",
+// so Serializing a Status Line is a Lookup and a memcpy.
+namespace HttpStatus {
+    struct Entry {
+        int code;
+        std::string_view reason;
+    };
+
+    // IANA HTTP Status Code Registry (RFC 9110 Names)
+    inline constexpr Entry Registered[] = {
+        { 100, "Continue" },
+        { 101, "Switching Protocols" },
+        { 102, "Processing" },
+        { 103, "Early Hints" },
+        { 200, "OK" },
+        { 201, "Created" },
+        { 202, "Accepted" },
+        { 203, "Non-Authoritative Information" },
+        { 204, "No Content" },
+        { 205, "Reset Content" },
+        { 206, "Partial Content" },
+        { 207, "Multi-Status" },
+        { 208, "Already Reported" },
+        { 226, "IM Used" },
+        { 300, "Multiple Choices" },
+        { 301, "Moved Permanently" },
+        { 302, "Found" },
+        { 303, "See Other" },
+        { 304, "Not Modified" },
+        { 305, "Use Proxy" },
+        { 307, "Temporary Redirect" },
+        { 308, "Permanent Redirect" },
+        { 400, "Bad Request" },
+        { 401, "Unauthorized" },
+        { 402, "Payment Required" },
+        { 403, "Forbidden" },
+        { 404, "Not Found" },
+        { 405, "Method Not Allowed" },
+        { 406, "Not Acceptable" },
+        { 407, "Proxy Authentication Required" },
+        { 408, "Request Timeout" },
+        { 409, "Conflict" },
+        { 410, "Gone" },
+        { 411, "Length Required" },
+        { 412, "Precondition Failed" },
+        { 413, "Content Too Large" },
+        { 414, "URI Too Long" },
+        { 415, "Unsupported Media Type" },
+        { 416, "Range Not Satisfiable" },
+        { 417, "Expectation Failed" },
+        { 418, "I'm a teapot" },
+        { 421, "Misdirected Request" },
+        { 422, "Unprocessable Content" },
+        { 423, "Locked" },
+        { 424, "Failed Dependency" },
+        { 425, "Too Early" },
+        { 426, "Upgrade Required" },
+        { 428, "Precondition Required" },
+        { 429, "Too Many Requests" },
+        { 431, "Request Header Fields Too Large" },
+        { 451, "Unavailable For Legal Reasons" },
+        { 500, "Internal Server Error" },
+        { 501, "Not Implemented" },
+        { 502, "Bad Gateway" },
+        { 503, "Service Unavailable" },
+        { 504, "Gateway Timeout" },
+        { 505, "HTTP Version Not Supported" },
+        { 506, "Variant Also Negotiates" },
+        { 507, "Insufficient Storage" },
+        { 508, "Loop Detected" },
+        { 510, "Not Extended" },
+        { 511, "Network Authentication Required" },
+    };
+
+    inline constexpr int FirstCode = 100;
+    inline constexpr int LastCode = 599;
+    inline constexpr std::string_view Prefix = "HTTP/1.1 ";
+
+    constexpr size_t lineLength(const Entry& entry) {
+        return Prefix.size() + 3 + 1 + entry.reason.size() + 2;
+    }
+
+    constexpr size_t totalLength() {
+        size_t total = 0;
+        for (const auto& entry : Registered) {
+            total += lineLength(entry);
+        }
+        return total;
+    }
+
+    class LineTable {
+    public:
+        constexpr LineTable() : storage_{}, offsets_{}, lengths_{} {
+            size_t offset = 0;
+            for (const auto& entry : Registered) {
+                size_t start = offset;
+                for (char c : Prefix) storage_[offset++] = c;
+                storage_[offset++] = static_cast<char>('0' + entry.code / 100);
+                storage_[offset++] = static_cast<char>('0' + entry.code / 10 % 10);
+                storage_[offset++] = static_cast<char>('0' + entry.code % 10);
+                storage_[offset++] = ' ';
+                for (char c : entry.reason) storage_[offset++] = c;
+                storage_[offset++] = '\r';
+                storage_[offset++] = '\n';
+
+                offsets_[entry.code - FirstCode] = static_cast<uint16_t>(start);
+                lengths_[entry.code - FirstCode] = static_cast<uint8_t>(offset - start);
+            }
+        }
+
+        // Empty for Unregistered Codes
+        constexpr std::string_view operator[](int code) const {
+            if (code < FirstCode || code > LastCode) return {};
+            size_t index = static_cast<size_t>(code - FirstCode);
+            return std::string_view(storage_.data() + offsets_[index], lengths_[index]);
+        }
+
+    private:
+        std::array<char, totalLength()> storage_;
+        std::array<uint16_t, LastCode - FirstCode + 1> offsets_;
+        std::array<uint8_t, LastCode - FirstCode + 1> lengths_;
+    };
+
+    inline constexpr LineTable Lines;
+
+    // "HTTP/1.1 NNN Reason\r\n", or Empty if the Code is Not Registered
+    constexpr std::string_view statusLine(int code) {
+        return Lines[code];
+    }
+
+    static_assert(statusLine(200) == "HTTP/1.1 200 OK\r\n");
+    static_assert(statusLine(404) == "HTTP/1.1 404 Not Found\r\n");
+    static_assert(statusLine(299).empty());
+}
@@ -0,0 +1,10 @@
+#include "IOEngine.h"
+#include "EpollEngine.h"
+
+std::unique_ptr<IOEngine> IOEngine::createDefault() {
+#ifdef __linux__
+    return std::make_unique<EpollEngine>();
+#else
+    return nullptr;
+#endif
+}
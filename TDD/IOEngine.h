@@ -0,0 +1,54 @@
+#pragma once
+
+#if !defined(_WIN32)
+#define API
+#elif defined(LIB_EXPORTS)
+#define API __declspec(dllexport)
+#else
+#define API __declspec(dllimport)
+#endif
+
+#include "Socket.h"
+#include <memory>
+#include <expected>
+#include <span>
+#include <cstdint>
+
+// Readiness Notification Delivered by an IOEngine
+struct IOEvent {
+    void* userData;
+    uint32_t events;
+};
+
+// Readiness Engine Abstraction (epoll on Linux)
+class API IOEngine {
+public:
+    enum Events : uint32_t {
+        Readable = 1u << 0,
+        Writable = 1u << 1,
+        HangUp = 1u << 2,
+        Error = 1u << 3,
+
+        // Registration Flags
+        EdgeTriggered = 1u << 8,
+        OneShot = 1u << 9
+    };
+
+    virtual SocketError init() = 0;
+
+    // Registration
+    virtual SocketError add(const Socket& socket, uint32_t events, void* userData) = 0;
+    virtual SocketError modify(const Socket& socket, uint32_t events, void* userData) = 0;
+    virtual SocketError remove(const Socket& socket) = 0;
+
+    // Block up to timeoutMs (-1 = Forever); Returns Number of Events Written
+    virtual std::expected<size_t, SocketError> wait(std::span<IOEvent> events, int timeoutMs) = 0;
+
+    // Interrupt a Blocked wait() From Another Thread
+    virtual void wakeup() = 0;
+
+    // Platform Default Engine, nullptr When None is Available
+    static std::unique_ptr<IOEngine> createDefault();
+
+    virtual ~IOEngine() = default;
+};
@@ -0,0 +1,304 @@
+#include "IoUring.h"
+
+#ifdef __linux__
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace {
+    int setup(unsigned entries, io_uring_params& params) {
+        return static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    }
+
+    int enter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags, const void* arg, size_t argSize) {
+        return static_cast<int>(syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, arg, argSize));
+    }
+
+    void* mapRing(int fd, size_t size, off_t offset) {
+        return mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+    }
+
+    size_t roundToPages(size_t size) {
+        size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        return (size + page - 1) / page * page;
+    }
+}
+
+IoUring::IoUring()
+    : fd_(-1),
+    sqPoll_(false),
+    sqRing_(nullptr),
+    sqRingSize_(0),
+    cqRing_(nullptr),
+    cqRingSize_(0),
+    sqes_(nullptr),
+    sqesSize_(0),
+    sqHead_(nullptr),
+    sqTail_(nullptr),
+    sqFlags_(nullptr),
+    sqArray_(nullptr),
+    sqMask_(0),
+    sqEntries_(0),
+    cqHead_(nullptr),
+    cqTail_(nullptr),
+    cqes_(nullptr),
+    cqMask_(0),
+    sqLocalTail_(0),
+    bufferRing_(nullptr),
+    bufferRingSize_(0),
+    buffers_(nullptr),
+    buffersSize_(0),
+    bufferSize_(0),
+    bufferMask_(0),
+    bufferTail_(0),
+    enters_(0) {
+}
+
+IoUring::~IoUring() {
+    release();
+}
+
+SocketError IoUring::init(const Options& options) {
+    if (fd_ >= 0) return SocketError::success();
+
+    // Cooperative Task Running Skips an Interrupt per Completion; Older
+    // Kernels Reject the Flag, so Retry Without it
+    io_uring_params params{};
+    if (options.sqPoll) {
+        params.flags = IORING_SETUP_SQPOLL;
+        params.sq_thread_idle = options.sqPollIdleMs;
+    }
+    else {
+        params.flags = IORING_SETUP_COOP_TASKRUN;
+    }
+
+    int fd = setup(options.entries, params);
+    if (fd < 0 && errno == EINVAL && !options.sqPoll) {
+        std::memset(&params, 0, sizeof(params));
+        fd = setup(options.entries, params);
+    }
+    if (fd < 0) {
+        return { SocketError::Type::Initialization, errno };
+    }
+    fd_ = fd;
+    sqPoll_ = options.sqPoll;
+
+    // Timed Waits Need the Extended Enter Argument (5.11)
+    if (!(params.features & IORING_FEAT_EXT_ARG)) {
+        release();
+        return { SocketError::Type::Initialization, ENOSYS };
+    }
+
+    sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cqRingSize_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool singleMap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (singleMap) {
+        sqRingSize_ = cqRingSize_ = std::max(sqRingSize_, cqRingSize_);
+    }
+
+    sqRing_ = mapRing(fd_, sqRingSize_, IORING_OFF_SQ_RING);
+    if (sqRing_ == MAP_FAILED) {
+        sqRing_ = nullptr;
+        int error = errno;
+        release();
+        return { SocketError::Type::Initialization, error };
+    }
+
+    cqRing_ = singleMap ? sqRing_ : mapRing(fd_, cqRingSize_, IORING_OFF_CQ_RING);
+    sqesSize_ = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes = cqRing_ == MAP_FAILED ? MAP_FAILED : mapRing(fd_, sqesSize_, IORING_OFF_SQES);
+    if (cqRing_ == MAP_FAILED || sqes == MAP_FAILED) {
+        int error = errno;
+        if (cqRing_ == MAP_FAILED) cqRing_ = nullptr;
+        release();
+        return { SocketError::Type::Initialization, error };
+    }
+    sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+    auto* sq = static_cast<uint8_t*>(sqRing_);
+    sqHead_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    sqTail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    sqFlags_ = reinterpret_cast<unsigned*>(sq + params.sq_off.flags);
+    sqArray_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    sqMask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sqEntries_ = params.sq_entries;
+
+    auto* cq = static_cast<uint8_t*>(cqRing_);
+    cqHead_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    cqTail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    cqMask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+
+    // Slot i Always Holds SQE i, so the Indirection Array is Written Once
+    for (unsigned i = 0; i < sqEntries_; ++i) {
+        sqArray_[i] = i;
+    }
+    sqLocalTail_ = *sqTail_;
+
+    return SocketError::success();
+}
+
+bool IoUring::isOpen() const {
+    return fd_ >= 0;
+}
+
+bool IoUring::usesSqPoll() const {
+    return sqPoll_;
+}
+
+int IoUring::fd() const {
+    return fd_;
+}
+
+io_uring_sqe* IoUring::getSqe() {
+    unsigned head = std::atomic_ref<unsigned>(*sqHead_).load(std::memory_order_acquire);
+    if (sqLocalTail_ - head >= sqEntries_) {
+        return nullptr;
+    }
+
+    io_uring_sqe* sqe = &sqes_[sqLocalTail_ & sqMask_];
+    ++sqLocalTail_;
+    std::memset(sqe, 0, sizeof(*sqe));
+    return sqe;
+}
+
+std::expected<unsigned, SocketError> IoUring::submitAndWait(int timeoutMs) {
+    publishBuffers();
+
+    unsigned toSubmit = sqLocalTail_ - *sqTail_;
+    std::atomic_ref<unsigned>(*sqTail_).store(sqLocalTail_, std::memory_order_release);
+
+    unsigned flags = 0;
+    if (sqPoll_) {
+        // The Poller Takes Them From the Tail; Only a Sleeping One Needs the Call
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        bool asleep = std::atomic_ref<unsigned>(*sqFlags_).load(std::memory_order_relaxed) & IORING_SQ_NEED_WAKEUP;
+        flags = asleep ? IORING_ENTER_SQ_WAKEUP : 0;
+        toSubmit = 0;
+    }
+
+    auto ready = [this] {
+        return std::atomic_ref<unsigned>(*cqTail_).load(std::memory_order_acquire) - *cqHead_;
+    };
+
+    // Completions Already Waiting: Submit Without Blocking (or Not Enter at All)
+    unsigned minComplete = 1;
+    if (ready() > 0 || timeoutMs == 0) {
+        if (toSubmit == 0 && flags == 0) {
+            return ready();
+        }
+        minComplete = 0;
+    }
+    else {
+        flags |= IORING_ENTER_GETEVENTS;
+    }
+
+    io_uring_getevents_arg arg{};
+    __kernel_timespec timeout{};
+    const void* argPointer = nullptr;
+    size_t argSize = 0;
+    if (minComplete > 0 && timeoutMs >= 0) {
+        timeout.tv_sec = timeoutMs / 1000;
+        timeout.tv_nsec = static_cast<long long>(timeoutMs % 1000) * 1000000;
+        arg.ts = reinterpret_cast<uint64_t>(&timeout);
+        flags |= IORING_ENTER_EXT_ARG;
+        argPointer = &arg;
+        argSize = sizeof(arg);
+    }
+
+    enters_.fetch_add(1, std::memory_order_relaxed);
+    if (enter(fd_, toSubmit, minComplete, flags, argPointer, argSize) < 0) {
+        // Timed Out, Interrupted, or Completions Backed Up: Just Reap
+        if (errno != ETIME && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            return std::unexpected(SocketError{ SocketError::Type::Poll, errno });
+        }
+    }
+    return ready();
+}
+
+SocketError IoUring::setupBuffers(unsigned count, size_t size) {
+    if (fd_ < 0 || bufferRing_ || count == 0 || count > 32768 || (count & (count - 1)) != 0) {
+        return { SocketError::Type::Initialization, EINVAL };
+    }
+
+    bufferRingSize_ = roundToPages(count * sizeof(io_uring_buf));
+    void* ring = mmap(nullptr, bufferRingSize_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ring == MAP_FAILED) {
+        return { SocketError::Type::Initialization, errno };
+    }
+    bufferRing_ = static_cast<io_uring_buf_ring*>(ring);
+
+    buffersSize_ = roundToPages(count * size);
+    void* buffers = mmap(nullptr, buffersSize_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (buffers == MAP_FAILED) {
+        return { SocketError::Type::Initialization, errno };
+    }
+    buffers_ = static_cast<uint8_t*>(buffers);
+    bufferSize_ = size;
+    bufferMask_ = count - 1;
+
+    io_uring_buf_reg registration{};
+    registration.ring_addr = reinterpret_cast<uint64_t>(bufferRing_);
+    registration.ring_entries = count;
+    registration.bgid = BufferGroup;
+    if (syscall(__NR_io_uring_register, fd_, IORING_REGISTER_PBUF_RING, &registration, 1) < 0) {
+        return { SocketError::Type::Initialization, errno };
+    }
+
+    for (unsigned id = 0; id < count; ++id) {
+        recycleBuffer(static_cast<uint16_t>(id));
+    }
+    publishBuffers();
+    return SocketError::success();
+}
+
+std::span<const uint8_t> IoUring::buffer(uint16_t id, size_t length) const {
+    return { buffers_ + static_cast<size_t>(id) * bufferSize_, std::min(length, bufferSize_) };
+}
+
+void IoUring::recycleBuffer(uint16_t id) {
+    // Not bufferRing_->bufs: in C++ the Header's Flexible-Array Wrapper Adds
+    // a Byte, Pushing bufs 8 Bytes Past Where the Kernel Reads Slot 0
+    auto* slots = reinterpret_cast<io_uring_buf*>(bufferRing_);
+    io_uring_buf& slot = slots[bufferTail_ & bufferMask_];
+    slot.addr = reinterpret_cast<uint64_t>(buffers_ + static_cast<size_t>(id) * bufferSize_);
+    slot.len = static_cast<uint32_t>(bufferSize_);
+    slot.bid = id;
+    ++bufferTail_;
+}
+
+size_t IoUring::enterCount() const {
+    return enters_.load(std::memory_order_relaxed);
+}
+
+void IoUring::publishBuffers() {
+    if (bufferRing_) {
+        std::atomic_ref<uint16_t>(bufferRing_->tail).store(bufferTail_, std::memory_order_release);
+    }
+}
+
+void IoUring::release() {
+    // Closing the Ring Cancels Whatever the Kernel Still Holds
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+
+    if (sqes_) munmap(sqes_, sqesSize_);
+    if (cqRing_ && cqRing_ != sqRing_) munmap(cqRing_, cqRingSize_);
+    if (sqRing_) munmap(sqRing_, sqRingSize_);
+    if (bufferRing_) munmap(bufferRing_, bufferRingSize_);
+    if (buffers_) munmap(buffers_, buffersSize_);
+
+    sqes_ = nullptr;
+    cqRing_ = nullptr;
+    sqRing_ = nullptr;
+    bufferRing_ = nullptr;
+    buffers_ = nullptr;
+}
+
+#endif
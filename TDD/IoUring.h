@@ -0,0 +1,124 @@
+#pragma once
+
+#if !defined(_WIN32)
+#define API
+#elif defined(LIB_EXPORTS)
+#define API __declspec(dllexport)
+#else
+#define API __declspec(dllimport)
+#endif
+
+#ifdef __linux__
+
+#include "Socket.h"
+#include <linux/io_uring.h>
+#include <atomic>
+#include <expected>
+#include <span>
+#include <cstddef>
+#include <cstdint>
+
+// Minimal io_uring Instance Over the Raw System Calls (No liburing)
+//
+// Owns the Submission and Completion Rings and, Optionally, One Provided
+// Buffer Ring the Kernel Picks Receive Buffers From. SQEs Accumulate Until
+// submitAndWait(), so Everything Queued in a Loop Iteration Costs One
+// io_uring_enter. With SQ Polling a Kernel Thread Picks SQEs Up Itself and
+// the Call is Skipped Unless There is Nothing to Reap. Single Thread Only.
+class API IoUring {
+public:
+    struct Options {
+        unsigned entries = 256;         // Submission Slots; Completions Get Twice as Many
+        bool sqPoll = false;            // Kernel Thread Polls the Submission Ring
+        unsigned sqPollIdleMs = 1000;   // Before the Poller Sleeps and Needs a Wakeup
+    };
+
+    // Provided Buffers Share One Group per Ring
+    static constexpr uint16_t BufferGroup = 0;
+
+    IoUring();
+    ~IoUring();
+
+    SocketError init(const Options& options);
+    bool isOpen() const;
+    bool usesSqPoll() const;
+    // Target for IORING_OP_MSG_RING From Other Rings
+    int fd() const;
+
+    // Next Free Submission Slot, Zeroed; nullptr Only When All Slots are Queued
+    io_uring_sqe* getSqe();
+
+    // Submits Queued SQEs and Waits up to timeoutMs (-1 = Forever) for at
+    // Least One Completion; Returns the Completions Ready to Reap
+    std::expected<unsigned, SocketError> submitAndWait(int timeoutMs);
+
+    // Visits Ready Completions Oldest First, Then Frees Their Slots
+    template<class Visitor>
+    unsigned forEachCompletion(Visitor&& visit) {
+        unsigned head = *cqHead_;
+        unsigned tail = std::atomic_ref<unsigned>(*cqTail_).load(std::memory_order_acquire);
+        unsigned count = tail - head;
+        for (; head != tail; ++head) {
+            visit(cqes_[head & cqMask_]);
+        }
+        std::atomic_ref<unsigned>(*cqHead_).store(tail, std::memory_order_release);
+        return count;
+    }
+
+    // count Buffers of size Bytes (count a Power of Two), All Handed to the Kernel
+    SocketError setupBuffers(unsigned count, size_t size);
+    std::span<const uint8_t> buffer(uint16_t id, size_t length) const;
+    // Gives a Buffer Back; Published With the Next Submission
+    void recycleBuffer(uint16_t id);
+
+    // io_uring_enter Calls Made so Far; Loads are Relaxed, so Any Thread May Read
+    size_t enterCount() const;
+
+    // Delete Copy/Move Operations
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+    IoUring(IoUring&&) = delete;
+    IoUring& operator=(IoUring&&) = delete;
+
+private:
+    void publishBuffers();
+    void release();
+
+    int fd_;
+    bool sqPoll_;
+
+    // Ring Mappings
+    void* sqRing_;
+    size_t sqRingSize_;
+    void* cqRing_;
+    size_t cqRingSize_;
+    io_uring_sqe* sqes_;
+    size_t sqesSize_;
+
+    // Shared Ring Indices (Kernel Writes sqHead_ and cqTail_)
+    unsigned* sqHead_;
+    unsigned* sqTail_;
+    unsigned* sqFlags_;
+    unsigned* sqArray_;
+    unsigned sqMask_;
+    unsigned sqEntries_;
+    unsigned* cqHead_;
+    unsigned* cqTail_;
+    io_uring_cqe* cqes_;
+    unsigned cqMask_;
+
+    unsigned sqLocalTail_;      // Includes SQEs Not Yet Published
+
+    // Provided Buffers
+    io_uring_buf_ring* bufferRing_;
+    size_t bufferRingSize_;
+    uint8_t* buffers_;
+    size_t buffersSize_;
+    size_t bufferSize_;
+    unsigned bufferMask_;
+    uint16_t bufferTail_;       // Includes Buffers Not Yet Published
+
+    std::atomic<size_t> enters_;
+};
+
+#endif
@@ -0,0 +1,518 @@
+#include "IoUringLoop.h"
+
+#ifdef __linux__
+
+#include "PosixSocket.h"
+#include "AcceptDrain.h"
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+namespace {
+    constexpr int WaitTimeoutMs = 1000;
+    constexpr std::chrono::seconds DrainTimeout(1);
+
+    // Operation Kind in the Low Bits of user_data, Connection Pointer Above
+    enum Operation : uint64_t {
+        Accept = 1,
+        Wakeup = 2,
+        Cancel = 3,
+        Receive = 4,
+        Send = 5,
+        Adopt = 6,      // Posted by the Accepting Loop: Sessions are Pending
+        Notify = 7      // The Accepting Loop's Own Completion of That Post
+    };
+    constexpr uint64_t OperationMask = 7;
+}
+
+IoUringLoop::IoUringLoop(
+    std::pmr::memory_resource* resource,
+    SessionFactory factory,
+    SessionHandler handler,
+    Config config
+) :
+    resource_(resource),
+    factory_(std::move(factory)),
+    handler_(std::move(handler)),
+    config_(config),
+    running_(false),
+    wakeupFd_(-1),
+    wakeupValue_(0),
+    listenFd_(-1),
+    peers_(resource),
+    nextPeer_(0),
+    pending_(resource),
+    connections_(resource),
+    ready_(resource),
+    inFlight_(0),
+    sessionCount_(0),
+    lastSweep_(std::chrono::steady_clock::now())
+{
+    static_assert(alignof(Connection) > OperationMask);
+}
+
+IoUringLoop::~IoUringLoop() {
+    stop();
+    if (wakeupFd_ >= 0) ::close(wakeupFd_);
+}
+
+void IoUringLoop::acceptOn(const Socket& listener, std::span<IoUringLoop* const> peers) {
+    listenFd_ = static_cast<int>(listener.getNativeHandle());
+    peers_.assign(peers.begin(), peers.end());
+}
+
+SocketError IoUringLoop::start() {
+    auto ringResult = ring_.init(config_.ring);
+    if (ringResult.type == SocketError::Type::None) {
+        ringResult = ring_.setupBuffers(config_.bufferCount, ClientSession::ReadChunkSize);
+    }
+    if (ringResult.type != SocketError::Type::None) {
+        return ringResult;
+    }
+
+    wakeupFd_ = eventfd(0, EFD_CLOEXEC);
+    if (wakeupFd_ < 0) {
+        return { SocketError::Type::Initialization, errno };
+    }
+
+    running_ = true;
+    thread_ = std::thread(&IoUringLoop::run, this);
+    return SocketError::success();
+}
+
+void IoUringLoop::stop() {
+    if (!running_.exchange(false)) return;
+
+    uint64_t one = 1;
+    [[maybe_unused]] auto written = ::write(wakeupFd_, &one, sizeof(one));
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+
+    // The Kernel Holds Nothing Now; Sessions Close Their Sockets
+    connections_.clear();
+    sessionCount_ = 0;
+    resumed_.reset();
+
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    pending_.clear();
+}
+
+size_t IoUringLoop::getSessionCount() const {
+    return sessionCount_.load(std::memory_order_relaxed);
+}
+
+size_t IoUringLoop::getEnterCount() const {
+    return ring_.enterCount();
+}
+
+void IoUringLoop::run() {
+    armWakeup();
+    if (listenFd_ >= 0) {
+        armAccept();
+    }
+
+    while (running_) {
+        // Out of Descriptors, Wake for the Accept Retry Even if Nothing Else Happens
+        int timeoutMs = WaitTimeoutMs;
+        if (acceptRetryAt_) {
+            auto remaining = std::chrono::ceil<std::chrono::milliseconds>(*acceptRetryAt_ - std::chrono::steady_clock::now());
+            timeoutMs = static_cast<int>(std::clamp<long long>(remaining.count(), 0, WaitTimeoutMs));
+        }
+
+        auto waitResult = ring_.submitAndWait(timeoutMs);
+        if (!waitResult.has_value()) {
+            std::cerr << "io_uring wait failed: " << waitResult.error().internalCode << std::endl;
+            break;
+        }
+
+        ring_.forEachCompletion([this](const io_uring_cqe& cqe) { complete(cqe); });
+        resumeConnections();
+
+        if (acceptRetryAt_ && std::chrono::steady_clock::now() >= *acceptRetryAt_) {
+            acceptRetryAt_.reset();
+            armAccept();
+        }
+
+        // Handlers Run Once per Batch; Their Sends Go Out With the Next Wait
+        for (size_t i = 0; i < ready_.size(); ++i) {
+            Connection* connection = ready_[i];
+            connection->ready = false;
+            service(*connection);
+        }
+        ready_.clear();
+
+        sweepIdleSessions();
+    }
+
+    drain();
+}
+
+void IoUringLoop::drain() {
+    running_ = false;
+
+    // Cancel Everything, Then Reap Until the Kernel Lets Go of Our Memory
+    cancel(-1, IORING_ASYNC_CANCEL_ANY);
+
+    auto deadline = std::chrono::steady_clock::now() + DrainTimeout;
+    while (inFlight_ > 0 && std::chrono::steady_clock::now() < deadline) {
+        if (!ring_.submitAndWait(100).has_value()) {
+            break;
+        }
+        ring_.forEachCompletion([this](const io_uring_cqe& cqe) { complete(cqe); });
+        for (Connection* connection : ready_) {
+            connection->ready = false;
+        }
+        ready_.clear();
+    }
+}
+
+io_uring_sqe* IoUringLoop::nextSqe() {
+    // Full Submission Ring: Hand Over What is Queued, Without Waiting
+    io_uring_sqe* sqe = ring_.getSqe();
+    while (!sqe) {
+        if (!ring_.submitAndWait(0).has_value()) {
+            std::this_thread::yield();
+        }
+        sqe = ring_.getSqe();
+    }
+    ++inFlight_;
+    return sqe;
+}
+
+void IoUringLoop::armAccept() {
+    io_uring_sqe* sqe = nextSqe();
+    sqe->opcode = IORING_OP_ACCEPT;
+    sqe->fd = listenFd_;
+    sqe->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+    sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+    sqe->user_data = Accept;
+}
+
+void IoUringLoop::armWakeup() {
+    io_uring_sqe* sqe = nextSqe();
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = wakeupFd_;
+    sqe->addr = reinterpret_cast<uint64_t>(&wakeupValue_);
+    sqe->len = sizeof(wakeupValue_);
+    sqe->user_data = Wakeup;
+}
+
+void IoUringLoop::armReceive(Connection& connection) {
+    io_uring_sqe* sqe = nextSqe();
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = connection.fd;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = IoUring::BufferGroup;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->user_data = reinterpret_cast<uint64_t>(&connection) | Receive;
+
+    connection.receiving = true;
+    ++connection.inFlight;
+}
+
+void IoUringLoop::submitSend(Connection& connection, Socket::Segments segments) {
+    size_t count = std::min(segments.size(), Socket::MaxSendSegments);
+    for (size_t i = 0; i < count; ++i) {
+        connection.iov[i].iov_base = const_cast<uint8_t*>(segments[i].data());
+        connection.iov[i].iov_len = segments[i].size();
+    }
+    connection.message = msghdr{};
+    connection.message.msg_iov = connection.iov;
+    connection.message.msg_iovlen = count;
+
+    io_uring_sqe* sqe = nextSqe();
+    sqe->opcode = IORING_OP_SENDMSG;
+    sqe->fd = connection.fd;
+    sqe->addr = reinterpret_cast<uint64_t>(&connection.message);
+    sqe->len = 1;
+    sqe->msg_flags = MSG_NOSIGNAL;
+    sqe->user_data = reinterpret_cast<uint64_t>(&connection) | Send;
+
+    connection.sending = true;
+    ++connection.inFlight;
+}
+
+void IoUringLoop::cancel(int fd, uint32_t flags) {
+    io_uring_sqe* sqe = nextSqe();
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = fd;
+    sqe->cancel_flags = flags;
+    sqe->user_data = Cancel;
+}
+
+void IoUringLoop::complete(const io_uring_cqe& cqe) {
+    // Posted by Another Ring, so Nothing of Ours Finished
+    if ((cqe.user_data & OperationMask) == Adopt) {
+        registerPending();
+        return;
+    }
+
+    // Multishot Operations Stay Armed While the Kernel Sets F_MORE
+    bool finished = !(cqe.flags & IORING_CQE_F_MORE);
+    if (finished) {
+        --inFlight_;
+    }
+
+    auto* connection = reinterpret_cast<Connection*>(cqe.user_data & ~OperationMask);
+    switch (cqe.user_data & OperationMask) {
+    case Accept:
+        onAccept(cqe.res);
+        if (finished && running_) {
+            // The Backlog Still Holds the Connection, so Re-Arming Now Would Fail at Once, Forever
+            bool exhausted = cqe.res == -EMFILE || cqe.res == -ENFILE || cqe.res == -ENOBUFS || cqe.res == -ENOMEM;
+            if (exhausted) {
+                acceptRetryAt_ = std::chrono::steady_clock::now() + AcceptRetryInterval;
+            }
+            else {
+                armAccept();
+            }
+        }
+        break;
+    case Wakeup:
+        if (running_) {
+            armWakeup();
+        }
+        break;
+    case Receive:
+        onReceive(*connection, cqe);
+        if (finished) {
+            connection->receiving = false;
+            finishOperation(*connection);
+        }
+        break;
+    case Send:
+        onSend(*connection, cqe.res);
+        finishOperation(*connection);
+        break;
+    default:
+        break;
+    }
+}
+
+void IoUringLoop::onAccept(int result) {
+    if (result < 0) {
+        return;
+    }
+    if (!running_) {
+        ::close(result);
+        return;
+    }
+
+    auto socket = PosixSocket::fromAccepted(result, true, resource_);
+    SessionPtr session(nullptr, PMRDeleter<ClientSession>(resource_));
+    try {
+        session = factory_(socket);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Failed to create client session: " << e.what() << std::endl;
+    }
+    if (!session) {
+        socket->close();
+        return;
+    }
+
+    IoUringLoop* target = peers_.empty() ? this : peers_[nextPeer_++ % peers_.size()];
+    if (target == this) {
+        addConnection(std::move(session));
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(target->pendingMutex_);
+        target->pending_.push_back(std::move(session));
+    }
+    notify(*target);
+}
+
+void IoUringLoop::addConnection(SessionPtr session) {
+    auto connection = make_pmr_unique_ptr<Connection>(resource_, *this, std::move(session));
+    connection->fd = static_cast<int>(connection->session->getSocket()->getNativeHandle());
+    connection->session->setOwner(connection.get());
+
+    // Recv is Armed by the First service()
+    auto* raw = connection.get();
+    connections_.emplace(raw, std::move(connection));
+    sessionCount_.store(connections_.size(), std::memory_order_relaxed);
+    markReady(*raw);
+}
+
+void IoUringLoop::registerPending() {
+    std::pmr::vector<SessionPtr> adopted(resource_);
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        adopted.swap(pending_);
+    }
+
+    for (auto& session : adopted) {
+        if (running_) {
+            addConnection(std::move(session));
+        }
+    }
+}
+
+void IoUringLoop::notify(IoUringLoop& peer) {
+    // Posts an Adopt Completion Straight Into the Peer's Ring; Rides Along
+    // With This Loop's Next Submission, so it Costs No System Call of its Own
+    io_uring_sqe* sqe = nextSqe();
+    sqe->opcode = IORING_OP_MSG_RING;
+    sqe->fd = peer.ring_.fd();
+    sqe->addr = IORING_MSG_DATA;
+    sqe->off = Adopt;
+    sqe->user_data = Notify;
+}
+
+void IoUringLoop::onReceive(Connection& connection, const io_uring_cqe& cqe) {
+    ClientSession& session = *connection.session;
+
+    bool hasBuffer = cqe.flags & IORING_CQE_F_BUFFER;
+    auto id = static_cast<uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+
+    if (cqe.res > 0 && hasBuffer) {
+        auto data = ring_.buffer(id, static_cast<size_t>(cqe.res));
+
+        // Copied Out so the Buffer Goes Straight Back; Past the Limit, Close
+        auto& input = session.getInputBuffer();
+        auto space = input.writable(data.size());
+        if (space.size() >= data.size()) {
+            std::memcpy(space.data(), data.data(), data.size());
+            input.commit(data.size());
+            session.updateLastActivityTime();
+            connection.needsService = true;
+        }
+        else {
+            session.markInactive();
+        }
+    }
+    // Out of Provided Buffers: Re-Armed by service(); Anything Else Ends it
+    else if (cqe.res != -ENOBUFS) {
+        session.markInactive();
+    }
+
+    if (hasBuffer) {
+        ring_.recycleBuffer(id);
+    }
+
+    markReady(connection);
+}
+
+void IoUringLoop::onSend(Connection& connection, int result) {
+    connection.sending = false;
+    if (result < 0) {
+        connection.session->markInactive();
+    }
+    else {
+        connection.session->advanceOutput(static_cast<size_t>(result));
+        connection.session->updateLastActivityTime();
+    }
+    markReady(connection);
+}
+
+void IoUringLoop::finishOperation(Connection& connection) {
+    --connection.inFlight;
+    markReady(connection);
+}
+
+void IoUringLoop::Connection::resume(ClientSession&) {
+    // Once Pushed the Loop May Close and Free This Connection; Only the Loop is Touched After
+    IoUringLoop& owner = loop;
+    if (owner.resumed_.push(this)) {
+        uint64_t one = 1;
+        [[maybe_unused]] auto written = ::write(owner.wakeupFd_, &one, sizeof(one));
+    }
+}
+
+void IoUringLoop::resumeConnections() {
+    Connection* connection = resumed_.drain();
+    while (connection) {
+        Connection* next = connection->queueNext;
+        connection->session->markReturned();
+        connection->needsService = true;
+        markReady(*connection);
+        connection = next;
+    }
+}
+
+void IoUringLoop::markReady(Connection& connection) {
+    if (!connection.ready) {
+        connection.ready = true;
+        ready_.push_back(&connection);
+    }
+}
+
+void IoUringLoop::service(Connection& connection) {
+    ClientSession& session = *connection.session;
+
+    if (!connection.closing) {
+        // Send What is Queued; Once it is All Out, Let the Handler Queue More
+        while (session.isActive() && !connection.sending) {
+            auto segments = session.pendingOutput();
+            if (!segments.empty()) {
+                submitSend(connection, segments);
+                break;
+            }
+            if (!session.isActive() || !connection.needsService) {
+                break;
+            }
+
+            try {
+                connection.needsService = handler_(session);
+            }
+            catch (const std::exception& e) {
+                std::cerr << "io_uring loop handler exception: " << e.what() << std::endl;
+                session.markInactive();
+            }
+            catch (...) {
+                std::cerr << "Unknown exception in io_uring loop handler" << std::endl;
+                session.markInactive();
+            }
+        }
+
+        if (session.isActive() && !connection.receiving && running_) {
+            armReceive(connection);
+        }
+        if (!session.isActive()) {
+            beginClose(connection);
+        }
+    }
+
+    // A Worker Still Holding the Session Keeps the Connection Too
+    if (connection.closing && connection.inFlight == 0 && !session.isDispatched()) {
+        connections_.erase(&connection);
+        sessionCount_.store(connections_.size(), std::memory_order_relaxed);
+    }
+}
+
+void IoUringLoop::beginClose(Connection& connection) {
+    if (connection.closing) return;
+    connection.closing = true;
+
+    // Pending Recv (and Send) Complete With -ECANCELED
+    if (connection.inFlight > 0) {
+        cancel(connection.fd, IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL);
+    }
+}
+
+void IoUringLoop::sweepIdleSessions() {
+    auto now = std::chrono::steady_clock::now();
+    if (now - lastSweep_ < std::chrono::seconds(1)) return;
+    lastSweep_ = now;
+
+    std::pmr::vector<Connection*> expired(resource_);
+    for (const auto& [raw, connection] : connections_) {
+        if (!raw->closing && !raw->session->isDispatched() &&
+            now - raw->session->getLastActivityTime() > config_.idleTimeout) {
+            expired.push_back(raw);
+        }
+    }
+
+    for (auto* raw : expired) {
+        raw->session->markInactive();
+        service(*raw);
+    }
+}
+
+#endif
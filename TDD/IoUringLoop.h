@@ -0,0 +1,168 @@
+#pragma once
+
+#if !defined(_WIN32)
+#define API
+#elif defined(LIB_EXPORTS)
+#define API __declspec(dllexport)
+#else
+#define API __declspec(dllimport)
+#endif
+
+#ifdef __linux__
+
+#include "IoUring.h"
+#include "ClientSession.h"
+#include "MpscQueue.h"
+#include "PMRDeleter.h"
+#include <sys/socket.h>
+#include <memory>
+#include <memory_resource>
+#include <unordered_map>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <vector>
+#include <span>
+
+struct API IoUringLoopConfig {
+    IoUring::Options ring{ 1024 };
+    unsigned bufferCount = 256;                 // Provided Receive Buffers (Power of Two)
+    std::chrono::seconds idleTimeout{ 60 };
+};
+
+// Completion-Driven Reactor: One Thread Owning One io_uring and its Sessions
+//
+// An Accepting Loop Takes Connections With One Multishot Accept and Deals
+// Them Round-Robin to its Peers, Waking Each With a Ring-to-Ring Message.
+// Every Connection Gets One Multishot Recv Whose Data Lands in Kernel-Chosen
+// Provided Buffers, is Copied Into the Session's Input Buffer and the Buffer
+// Recycled at Once. Queued Output Leaves as One sendmsg per Session.
+// Everything a Batch of Completions Triggers Reaches the Kernel in One
+// io_uring_enter.
+class API IoUringLoop {
+public:
+    using SessionPtr = std::unique_ptr<ClientSession, PMRDeleter<ClientSession>>;
+    // Builds the Session for an Accepted Connection; nullptr Sheds it
+    using SessionFactory = std::function<SessionPtr(std::shared_ptr<Socket>)>;
+    // Invoked on the Loop Thread Once New Input Arrived (or Dispatched Work
+    // Returned) and Earlier Output Was Sent; Queues Responses. True Asks for
+    // Another Call When the Output Queued This Time Has Been Sent, Even
+    // Without New Input
+    using SessionHandler = std::function<bool(ClientSession&)>;
+
+    using Config = IoUringLoopConfig;
+
+    IoUringLoop(
+        std::pmr::memory_resource* resource,
+        SessionFactory factory,
+        SessionHandler handler,
+        Config config = Config()
+    );
+    ~IoUringLoop();
+
+    // Before start(): Accept on listener, Spreading Connections Over peers
+    // (This Loop Among Them; Empty Keeps All). Peers Must Already be Started
+    // and Stop Only After This Loop
+    void acceptOn(const Socket& listener, std::span<IoUringLoop* const> peers);
+
+    SocketError start();
+    void stop();
+
+    size_t getSessionCount() const;
+    // io_uring_enter Calls Made by the Loop
+    size_t getEnterCount() const;
+
+    // Deleted Copy/Move Ops
+    IoUringLoop(const IoUringLoop&) = delete;
+    IoUringLoop& operator=(const IoUringLoop&) = delete;
+    IoUringLoop(IoUringLoop&&) = delete;
+    IoUringLoop& operator=(IoUringLoop&&) = delete;
+
+private:
+    // A Session Plus the Operations the Kernel Holds for it; Owns the
+    // Session on Behalf of the Loop so Returned Work Finds its Connection
+    struct Connection : ClientSession::Owner {
+        Connection(IoUringLoop& owningLoop, SessionPtr owned) : loop(owningLoop), session(std::move(owned)) {}
+
+        void resume(ClientSession&) override;
+
+        IoUringLoop& loop;
+        SessionPtr session;
+        Connection* queueNext = nullptr;    // Link in resumed_
+        int fd = -1;
+        unsigned inFlight = 0;          // Submitted Operations Not Yet Finished
+        bool receiving = false;         // Multishot Recv Armed
+        bool sending = false;
+        bool closing = false;           // Cancelled; Destroyed Once inFlight Drops to 0
+        bool needsService = false;      // Handler Has Something to Look at
+        bool ready = false;             // Listed in ready_ for This Batch
+
+        // Read by the Kernel Until the Send Completes
+        msghdr message{};
+        iovec iov[Socket::MaxSendSegments];
+    };
+    using ConnectionPtr = std::unique_ptr<Connection, PMRDeleter<Connection>>;
+
+    void run();
+    void drain();
+    io_uring_sqe* nextSqe();
+    void armAccept();
+    void armWakeup();
+    void armReceive(Connection& connection);
+    void submitSend(Connection& connection, Socket::Segments segments);
+    void cancel(int fd, uint32_t flags);
+
+    void complete(const io_uring_cqe& cqe);
+    void onAccept(int result);
+    void addConnection(SessionPtr session);
+    void registerPending();
+    void notify(IoUringLoop& peer);
+    void onReceive(Connection& connection, const io_uring_cqe& cqe);
+    void onSend(Connection& connection, int result);
+    void finishOperation(Connection& connection);
+    void markReady(Connection& connection);
+    void resumeConnections();
+
+    void service(Connection& connection);
+    void beginClose(Connection& connection);
+    void sweepIdleSessions();
+
+    IoUring ring_;
+    std::pmr::memory_resource* resource_;
+    SessionFactory factory_;
+    SessionHandler handler_;
+    Config config_;
+
+    std::atomic<bool> running_;
+    std::thread thread_;
+
+    // Eventfd Read Kept Pending so stop() Can Interrupt a Wait
+    int wakeupFd_;
+    uint64_t wakeupValue_;
+
+    // Accepting Loop Only
+    int listenFd_;
+    std::pmr::vector<IoUringLoop*> peers_;
+    size_t nextPeer_;
+    // Set When Running Out of Descriptors Ended the Accept: Re-Armed Then, Not at Once
+    std::optional<std::chrono::steady_clock::time_point> acceptRetryAt_;
+
+    // Sessions Handed Over by the Accepting Loop
+    std::pmr::vector<SessionPtr> pending_;
+    std::mutex pendingMutex_;
+
+    // Connections Whose Workers Finished; Pushing the First Writes wakeupFd_
+    MpscQueue<Connection, &Connection::queueNext> resumed_;
+
+    // Owned Exclusively by the Loop Thread
+    std::pmr::unordered_map<Connection*, ConnectionPtr> connections_;
+    std::pmr::vector<Connection*> ready_;
+    size_t inFlight_;                   // All Submitted Operations, Internal Ones Included
+    std::atomic<size_t> sessionCount_;
+    std::chrono::steady_clock::time_point lastSweep_;
+};
+
+#endif
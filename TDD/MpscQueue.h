@@ -0,0 +1,54 @@
+#pragma once
+
+#include <atomic>
+
+// Intrusive Lock-Free Multi-Producer / Single-Consumer Queue
+//
+// Producers push with a single CAS; the consumer detaches the whole list
+// with one exchange. Nodes carry their own link (T::*Next), so pushing
+// never allocates.
+template<typename T, T* T::*Next>
+class MpscQueue {
+public:
+    MpscQueue() : head_(nullptr) {}
+
+    // Returns true if the Queue was Empty (Consumer May Need a Wakeup)
+    bool push(T* node) {
+        T* head = head_.load(std::memory_order_relaxed);
+        do {
+            node->*Next = head;
+        } while (!head_.compare_exchange_weak(head, node,
+            std::memory_order_release, std::memory_order_relaxed));
+        return head == nullptr;
+    }
+
+    // Detach Everything Pushed so Far, Oldest First
+    T* drain() {
+        T* node = head_.exchange(nullptr, std::memory_order_acquire);
+
+        T* ordered = nullptr;
+        while (node) {
+            T* next = node->*Next;
+            node->*Next = ordered;
+            ordered = node;
+            node = next;
+        }
+        return ordered;
+    }
+
+    // Forget Every Node Without Touching Them (Owner Already Destroyed Them)
+    void reset() {
+        head_.store(nullptr, std::memory_order_release);
+    }
+
+    bool empty() const {
+        return head_.load(std::memory_order_acquire) == nullptr;
+    }
+
+    // Deleted Copy/Move Ops
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+private:
+    std::atomic<T*> head_;
+};
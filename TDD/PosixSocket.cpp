@@ -0,0 +1,425 @@
+#include "PosixSocket.h"
+
+#ifdef __linux__
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <array>
+#include <expected>
+#include <memory_resource>
+
+SocketError PosixSocket::getLastError(SocketError::Type type) {
+    int error = errno;
+    if (error == EAGAIN || error == EWOULDBLOCK) {
+        return { SocketError::Type::WouldBlock, static_cast<int32_t>(error) };
+    }
+    return { type, static_cast<int32_t>(error) };
+}
+
+PosixSocket::PosixSocket(std::pmr::memory_resource* resource)
+    : fd_(-1),
+    initialized_(false),
+    nonBlocking_(false),
+    resource_(resource) {
+}
+
+PosixSocket::~PosixSocket() {
+    close();
+}
+
+void PosixSocket::cleanup() {
+    // No Process-Wide State to Release (Unlike WSACleanup)
+}
+
+SocketError PosixSocket::init() {
+    if (initialized_) return SocketError::success();
+
+    fd_ = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, IPPROTO_TCP);
+    if (fd_ < 0) {
+        return getLastError(SocketError::Type::Initialization);
+    }
+
+    // Allow Socket Reuse
+    int opt = 1;
+    if (setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt)) < 0) {
+        return getLastError(SocketError::Type::Initialization);
+    }
+    if (setsockopt(fd_, IPPROTO_TCP, TCP_NODELAY, &opt, sizeof(opt)) < 0) {
+        return getLastError(SocketError::Type::Initialization);
+    }
+
+    initialized_ = true;
+    return SocketError::success();
+}
+
+std::pmr::memory_resource* PosixSocket::getMemoryResource() const {
+    return resource_;
+}
+
+SocketError PosixSocket::bind(const std::pmr::string& address, uint16_t port) {
+    if (!initialized_) {
+        return { SocketError::Type::Initialization, 0 };
+    }
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    if (inet_pton(AF_INET, address.c_str(), &addr.sin_addr) != 1) {
+        return { SocketError::Type::Bind, EINVAL };
+    }
+
+    if (::bind(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+        return getLastError(SocketError::Type::Bind);
+    }
+
+    return SocketError::success();
+}
+
+SocketError PosixSocket::listen(int backlog) {
+    if (!initialized_) {
+        return { SocketError::Type::Initialization, 0 };
+    }
+
+    if (::listen(fd_, backlog) < 0) {
+        return getLastError(SocketError::Type::Connection);
+    }
+
+    return SocketError::success();
+}
+
+std::expected<std::shared_ptr<Socket>, SocketError> PosixSocket::accept() {
+    if (!initialized_) {
+        return std::unexpected(SocketError{ SocketError::Type::Initialization, 0 });
+    }
+
+    sockaddr_in clientAddr{};
+    socklen_t clientAddrLen = sizeof(clientAddr);
+
+    // Accepted Sockets Inherit the Listener's Blocking Mode (Matches Winsock)
+    int flags = SOCK_CLOEXEC | (nonBlocking_ ? SOCK_NONBLOCK : 0);
+    int clientFd = -1;
+    while (clientFd < 0) {
+        clientFd = ::accept4(fd_, reinterpret_cast<sockaddr*>(&clientAddr), &clientAddrLen, flags);
+        if (clientFd >= 0) {
+            break;
+        }
+
+        switch (errno) {
+        // The Next Connection in the Backlog May Be Fine; Linux Also Reports
+        // Network Errors Already Pending on the New Socket This Way
+        case EINTR:
+        case ECONNABORTED:
+        case EPROTO:
+        case EPERM:
+        case ENETDOWN:
+        case ENETUNREACH:
+        case EHOSTDOWN:
+        case EHOSTUNREACH:
+        case ENONET:
+        case ENOPROTOOPT:
+        case EOPNOTSUPP:
+            clientAddrLen = sizeof(clientAddr);
+            continue;
+        case EMFILE:
+        case ENFILE:
+        case ENOBUFS:
+        case ENOMEM:
+            return std::unexpected(SocketError{ SocketError::Type::Exhausted, static_cast<int32_t>(errno) });
+        default:
+            return std::unexpected(getLastError(SocketError::Type::Connection));
+        }
+    }
+
+    return fromAccepted(clientFd, nonBlocking_, resource_);
+}
+
+std::shared_ptr<PosixSocket> PosixSocket::fromAccepted(int fd, bool nonBlocking, std::pmr::memory_resource* resource) {
+    int opt = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &opt, sizeof(opt));
+
+    auto clientPosixSocket = std::make_shared<PosixSocket>(resource);
+    clientPosixSocket->fd_ = fd;
+    clientPosixSocket->initialized_ = true;
+    clientPosixSocket->nonBlocking_ = nonBlocking;
+
+    return clientPosixSocket;
+}
+
+SocketError PosixSocket::connect(const std::pmr::string& address, uint16_t port) {
+    if (!initialized_) {
+        return { SocketError::Type::Initialization, 0 };
+    }
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    if (inet_pton(AF_INET, address.c_str(), &addr.sin_addr) != 1) {
+        return { SocketError::Type::Connection, EINVAL };
+    }
+
+    if (::connect(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+        if (errno == EINPROGRESS) {
+            return { SocketError::Type::WouldBlock, EINPROGRESS };
+        }
+        return getLastError(SocketError::Type::Connection);
+    }
+
+    return SocketError::success();
+}
+
+SocketError PosixSocket::send(const std::pmr::vector<uint8_t>& data) {
+    if (!initialized_) {
+        return { SocketError::Type::Initialization, 0 };
+    }
+
+    // Send Everything, Even if the Kernel Takes it in Pieces
+    size_t sent = 0;
+    while (sent < data.size()) {
+        ssize_t result = ::send(fd_, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if ((errno == EAGAIN || errno == EWOULDBLOCK) && nonBlocking_) {
+                auto waitResult = waitWritable(std::chrono::milliseconds(-1));
+                if (!waitResult.has_value()) {
+                    return waitResult.error();
+                }
+                continue;
+            }
+            return getLastError(SocketError::Type::Send);
+        }
+        sent += static_cast<size_t>(result);
+    }
+
+    return SocketError::success();
+}
+
+std::expected<size_t, SocketError> PosixSocket::sendSome(std::span<const uint8_t> data) {
+    if (!initialized_) {
+        return std::unexpected(SocketError{ SocketError::Type::Initialization, 0 });
+    }
+
+    ssize_t result;
+    do {
+        result = ::send(fd_, data.data(), data.size(), MSG_NOSIGNAL);
+    } while (result < 0 && errno == EINTR);
+
+    if (result < 0) {
+        return std::unexpected(getLastError(SocketError::Type::Send));
+    }
+
+    return static_cast<size_t>(result);
+}
+
+std::expected<size_t, SocketError> PosixSocket::sendSegments(Segments segments, size_t index, size_t offset) {
+    std::array<iovec, MaxSendSegments> iov;
+    size_t count = 0;
+    for (; index < segments.size() && count < iov.size(); ++index, offset = 0) {
+        auto segment = segments[index].subspan(offset);
+        if (segment.empty()) continue;
+        iov[count++] = iovec{ const_cast<uint8_t*>(segment.data()), segment.size() };
+    }
+
+    if (count == 0) {
+        return size_t(0);
+    }
+
+    // sendmsg() Rather Than writev() for MSG_NOSIGNAL
+    msghdr message{};
+    message.msg_iov = iov.data();
+    message.msg_iovlen = count;
+
+    ssize_t result;
+    do {
+        result = ::sendmsg(fd_, &message, MSG_NOSIGNAL);
+    } while (result < 0 && errno == EINTR);
+
+    if (result < 0) {
+        return std::unexpected(getLastError(SocketError::Type::Send));
+    }
+
+    return static_cast<size_t>(result);
+}
+
+SocketError PosixSocket::sendv(Segments segments) {
+    if (!initialized_) {
+        return { SocketError::Type::Initialization, 0 };
+    }
+
+    size_t index = 0;
+    size_t offset = 0;
+    while (index < segments.size()) {
+        auto result = sendSegments(segments, index, offset);
+        if (!result.has_value()) {
+            if (result.error().type == SocketError::Type::WouldBlock && nonBlocking_) {
+                auto waitResult = waitWritable(std::chrono::milliseconds(-1));
+                if (!waitResult.has_value()) {
+                    return waitResult.error();
+                }
+                continue;
+            }
+            return result.error();
+        }
+
+        // Advance Past Whatever the Kernel Took
+        size_t sent = result.value();
+        while (index < segments.size() && sent >= segments[index].size() - offset) {
+            sent -= segments[index].size() - offset;
+            offset = 0;
+            ++index;
+        }
+        offset += sent;
+    }
+
+    return SocketError::success();
+}
+
+std::expected<size_t, SocketError> PosixSocket::sendvSome(Segments segments) {
+    if (!initialized_) {
+        return std::unexpected(SocketError{ SocketError::Type::Initialization, 0 });
+    }
+
+    return sendSegments(segments, 0, 0);
+}
+
+SocketError PosixSocket::setNonBlocking() {
+    if (!initialized_) return { SocketError::Type::Initialization, 0 };
+
+    int flags = fcntl(fd_, F_GETFL, 0);
+    if (flags < 0 || fcntl(fd_, F_SETFL, flags | O_NONBLOCK) < 0) {
+        return { SocketError::Type::Initialization, errno };
+    }
+
+    nonBlocking_ = true;
+    return SocketError::success();
+}
+
+SocketError PosixSocket::setReusePort() {
+    if (!initialized_) return { SocketError::Type::Initialization, 0 };
+
+    int opt = 1;
+    if (setsockopt(fd_, SOL_SOCKET, SO_REUSEPORT, &opt, sizeof(opt)) < 0) {
+        return getLastError(SocketError::Type::Initialization);
+    }
+    return SocketError::success();
+}
+
+std::shared_ptr<Socket> PosixSocket::createSibling() const {
+    return std::make_shared<PosixSocket>(resource_);
+}
+
+std::expected<std::pmr::vector<uint8_t>, SocketError> PosixSocket::receive(size_t maxSize) {
+    if (!initialized_) {
+        return std::unexpected(SocketError{ SocketError::Type::Initialization, 0 });
+    }
+
+    std::pmr::vector<uint8_t> buffer(maxSize, resource_);
+    auto bytesReceived = receiveInto(buffer);
+    if (!bytesReceived.has_value()) {
+        return std::unexpected(bytesReceived.error());
+    }
+
+    buffer.resize(bytesReceived.value());
+    return buffer;
+}
+
+std::expected<size_t, SocketError> PosixSocket::receiveInto(std::span<uint8_t> buffer) {
+    if (!initialized_) {
+        return std::unexpected(SocketError{ SocketError::Type::Initialization, 0 });
+    }
+
+    ssize_t bytesReceived;
+    do {
+        bytesReceived = ::recv(fd_, buffer.data(), buffer.size(), 0);
+    } while (bytesReceived < 0 && errno == EINTR);
+
+    if (bytesReceived < 0) {
+        return std::unexpected(getLastError(SocketError::Type::Receive));
+    }
+
+    return static_cast<size_t>(bytesReceived);
+}
+
+std::expected<bool, SocketError> PosixSocket::waitReadable(std::chrono::milliseconds timeout) {
+    if (!initialized_) {
+        return std::unexpected(SocketError{ SocketError::Type::Initialization, 0 });
+    }
+
+    pollfd pfd{ fd_, POLLIN, 0 };
+    int result;
+    do {
+        result = ::poll(&pfd, 1, static_cast<int>(timeout.count()));
+    } while (result < 0 && errno == EINTR);
+
+    if (result < 0) {
+        return std::unexpected(getLastError(SocketError::Type::Receive));
+    }
+
+    // Hang-Up/Error Count as Readable so the Caller Observes Them via receive()
+    return result > 0;
+}
+
+std::expected<bool, SocketError> PosixSocket::waitWritable(std::chrono::milliseconds timeout) {
+    if (!initialized_) {
+        return std::unexpected(SocketError{ SocketError::Type::Initialization, 0 });
+    }
+
+    pollfd pfd{ fd_, POLLOUT, 0 };
+    int result;
+    do {
+        result = ::poll(&pfd, 1, static_cast<int>(timeout.count()));
+    } while (result < 0 && errno == EINTR);
+
+    if (result < 0) {
+        return std::unexpected(getLastError(SocketError::Type::Send));
+    }
+
+    // Hang-Up/Error Count as Writable so the Caller Observes Them via send()
+    return result > 0;
+}
+
+void PosixSocket::close() {
+    if (initialized_ && fd_ >= 0) {
+        ::shutdown(fd_, SHUT_RDWR);
+        ::close(fd_);
+        fd_ = -1;
+        initialized_ = false;
+    }
+}
+
+int PosixSocket::setTimeout() {
+    // Set Socket Options
+    struct timeval timeout;
+    timeout.tv_sec = 5;  // 5 Second
+    timeout.tv_usec = 0;
+
+    if (setsockopt(fd_, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) < 0) {
+        return 1;
+    }
+
+    if (setsockopt(fd_, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout)) < 0) {
+        return 1;
+    }
+    return 0;
+}
+
+intptr_t PosixSocket::getNativeHandle() const {
+    return static_cast<intptr_t>(fd_);
+}
+
+bool PosixSocket::isSameSocket(const std::shared_ptr<Socket>& other) const {
+    if (auto* otherPosix = dynamic_cast<const PosixSocket*>(other.get())) {
+        return fd_ == otherPosix->fd_;
+    }
+    return false;
+}
+
+#endif
@@ -0,0 +1,69 @@
+#pragma once
+
+#if !defined(_WIN32)
+#define API
+#elif defined(LIB_EXPORTS)
+#define API __declspec(dllexport)
+#else
+#define API __declspec(dllimport)
+#endif
+
+#ifdef __linux__
+
+#include "Socket.h"
+#include <memory>
+#include <vector>
+#include <string>
+#include <expected>
+#include <memory_resource>
+
+class API PosixSocket : public Socket {
+public:
+    PosixSocket(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    ~PosixSocket() override;
+
+    SocketError init() override;
+    void cleanup() override;
+
+    SocketError bind(const std::pmr::string& address, uint16_t port) override;
+
+    SocketError listen(int backlog) override;
+
+    std::expected<std::shared_ptr<Socket>, SocketError> accept() override;
+
+    SocketError connect(const std::pmr::string& address, uint16_t port) override;
+
+    SocketError send(const std::pmr::vector<uint8_t>& data) override;
+    std::expected<size_t, SocketError> sendSome(std::span<const uint8_t> data) override;
+    SocketError sendv(Segments segments) override;
+    std::expected<size_t, SocketError> sendvSome(Segments segments) override;
+
+    std::expected<std::pmr::vector<uint8_t>, SocketError> receive(size_t maxSize) override;
+    std::expected<size_t, SocketError> receiveInto(std::span<uint8_t> buffer) override;
+    std::expected<bool, SocketError> waitReadable(std::chrono::milliseconds timeout) override;
+    std::expected<bool, SocketError> waitWritable(std::chrono::milliseconds timeout) override;
+
+    void close() override;
+    int setTimeout() override;
+    SocketError setNonBlocking() override;
+    SocketError setReusePort() override;
+    std::shared_ptr<Socket> createSibling() const override;
+    bool isSameSocket(const std::shared_ptr<Socket>& other) const override;
+    intptr_t getNativeHandle() const override;
+    std::pmr::memory_resource* getMemoryResource() const override;
+
+    // Takes Ownership of a Connection Accepted Outside accept() (io_uring)
+    static std::shared_ptr<PosixSocket> fromAccepted(int fd, bool nonBlocking, std::pmr::memory_resource* resource);
+private:
+    static SocketError getLastError(SocketError::Type type);
+
+    // One sendmsg() Starting offset Bytes Into segments[index]
+    std::expected<size_t, SocketError> sendSegments(Segments segments, size_t index, size_t offset);
+
+    int fd_;
+    bool initialized_;
+    bool nonBlocking_;
+    std::pmr::memory_resource* resource_;
+};
+
+#endif
@@ -0,0 +1,62 @@
+#include "Rcu.h"
+#include <thread>
+
+namespace {
+    std::atomic<size_t> nextShard(0);
+
+    // Threads Spread Round-Robin so Concurrent Readers Rarely Share a Line
+    size_t threadShard() {
+        thread_local size_t shard = nextShard.fetch_add(1, std::memory_order_relaxed) % RcuDomain::Shards;
+        return shard;
+    }
+
+    thread_local size_t readDepth = 0;
+}
+
+RcuDomain::RcuDomain()
+    : phase_(0) {
+    for (auto& shard : shards_) {
+        shard.readers[0].store(0, std::memory_order_relaxed);
+        shard.readers[1].store(0, std::memory_order_relaxed);
+    }
+}
+
+// Sequentially Consistent on Purpose: a Reader Whose Increment Lands After
+// the Writer Checked its Shard is Then Guaranteed to Load the New Pointer
+unsigned RcuDomain::enter() {
+    unsigned phase = phase_.load() & 1;
+    shards_[threadShard()].readers[phase].fetch_add(1);
+    ++readDepth;
+    return phase;
+}
+
+void RcuDomain::exit(unsigned phase) {
+    --readDepth;
+    shards_[threadShard()].readers[phase].fetch_sub(1, std::memory_order_release);
+}
+
+void RcuDomain::waitForReaders(unsigned phase) {
+    for (auto& shard : shards_) {
+        while (shard.readers[phase].load() != 0) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void RcuDomain::synchronize() {
+    std::lock_guard<std::mutex> lock(writerMutex_);
+
+    unsigned current = phase_.load() & 1;
+
+    // Stragglers That Read the Phase Just Before the Previous Flip Still
+    // Count Against the Inactive Side; They Must Leave First
+    waitForReaders(current ^ 1);
+
+    // New Readers Move to the Other Side; Drain the One the Old Version Used
+    phase_.store(current ^ 1);
+    waitForReaders(current);
+}
+
+bool RcuDomain::inReadSection() {
+    return readDepth != 0;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#if !defined(_WIN32)
+#define API
+#elif defined(LIB_EXPORTS)
+#define API __declspec(dllexport)
+#else
+#define API __declspec(dllimport)
+#endif
+
+#include <atomic>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+
+// Read-Copy-Update Grace Periods for Data Published Through an Atomic Pointer
+//
+// Readers Bracket Every Access With a ReadGuard: Two Uncontended Atomic Ops
+// on a Per-Thread Shard, No Locks, No Shared Cache Line. A Writer Publishes
+// a New Version With an Atomic Exchange, Then synchronize() Waits Until
+// Every Reader That Could Still See the Old Version Has Left, After Which
+// the Old Version May be Freed. Readers Entering During the Wait Count
+// Against the Other Phase and Never Delay it.
+class API RcuDomain {
+public:
+    static constexpr size_t Shards = 64;
+
+    class ReadGuard {
+    public:
+        explicit ReadGuard(RcuDomain& domain)
+            : domain_(domain), phase_(domain.enter()) {
+        }
+        ~ReadGuard() {
+            domain_.exit(phase_);
+        }
+
+        // Deleted Copy/Move Ops
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+    private:
+        RcuDomain& domain_;
+        unsigned phase_;
+    };
+
+    RcuDomain();
+
+    // Blocks Until Every Read Section Started Before the Call Has Ended.
+    // Must Not be Called From Inside a Read Section (it Would Wait on Itself)
+    void synchronize();
+
+    // True While the Calling Thread Holds a ReadGuard on Any Domain
+    static bool inReadSection();
+
+    // Deleted Copy/Move Ops
+    RcuDomain(const RcuDomain&) = delete;
+    RcuDomain& operator=(const RcuDomain&) = delete;
+    RcuDomain(RcuDomain&&) = delete;
+    RcuDomain& operator=(RcuDomain&&) = delete;
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> readers[2];
+    };
+
+    unsigned enter();
+    void exit(unsigned phase);
+    void waitForReaders(unsigned phase);
+
+    Shard shards_[Shards];
+    std::atomic<unsigned> phase_;
+    std::mutex writerMutex_;    // One Grace Period at a Time
+};
@@ -0,0 +1,301 @@
+#include "RequestParser.h"
+#include "ByteScanner.h"
+
+namespace {
+    constexpr size_t MaxContentLengthDigits = 18;
+
+    char toLowerAscii(char c) {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    std::string_view trimWhitespace(std::string_view value) {
+        while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) value.remove_prefix(1);
+        while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) value.remove_suffix(1);
+        return value;
+    }
+
+    bool parseContentLength(std::string_view value, size_t& length) {
+        if (value.empty() || value.size() > MaxContentLengthDigits) return false;
+
+        size_t result = 0;
+        for (char c : value) {
+            if (c < '0' || c > '9') return false;
+            result = result * 10 + static_cast<size_t>(c - '0');
+        }
+        length = result;
+        return true;
+    }
+}
+
+bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (toLowerAscii(a[i]) != toLowerAscii(b[i])) return false;
+    }
+    return true;
+}
+
+std::optional<std::string_view> RequestView::header(std::string_view name) const {
+    for (const auto& header : headers) {
+        if (equalsIgnoreCase(header.name, name)) {
+            return header.value;
+        }
+    }
+    return std::nullopt;
+}
+
+bool RequestView::keepAlive() const {
+    if (auto connection = header("Connection")) {
+        // Comma-Separated Token List
+        std::string_view tokens = *connection;
+        while (!tokens.empty()) {
+            size_t comma = tokens.find(',');
+            auto token = trimWhitespace(tokens.substr(0, comma));
+            if (equalsIgnoreCase(token, "close")) return false;
+            if (equalsIgnoreCase(token, "keep-alive")) return true;
+            if (comma == std::string_view::npos) break;
+            tokens.remove_prefix(comma + 1);
+        }
+    }
+
+    // For HTTP/1.1, Default is keep-alive; for HTTP/1.0, Default is close
+    return version == "HTTP/1.1";
+}
+
+RequestParser::RequestParser()
+    : maxBodySize_(DefaultMaxBodyBytes) {
+    reset();
+}
+
+void RequestParser::setMaxBodySize(size_t bytes) {
+    maxBodySize_ = bytes;
+}
+
+bool RequestParser::bodyFits(size_t bytes) const {
+    return bytes <= maxBodySize_;
+}
+
+std::optional<bool> RequestParser::streamingRoute() const {
+    return streamingRoute_;
+}
+
+void RequestParser::setStreamingRoute(bool streaming) {
+    streamingRoute_ = streaming;
+}
+
+void RequestParser::reset() {
+    phase_ = Phase::Head;
+    skipped_ = 0;
+    scanOffset_ = 0;
+    headLength_ = 0;
+    bodyLength_ = 0;
+    parsedBase_ = nullptr;
+    headerCount_ = 0;
+    chunked_ = false;
+    errorStatus_ = 0;
+    streamingRoute_.reset();
+    request_ = RequestView{};
+}
+
+const RequestView& RequestParser::request() const {
+    return request_;
+}
+
+size_t RequestParser::consumed() const {
+    return skipped_ + headLength_ + bodyLength_;
+}
+
+size_t RequestParser::headSize() const {
+    return skipped_ + headLength_;
+}
+
+bool RequestParser::chunked() const {
+    return chunked_;
+}
+
+int RequestParser::errorStatus() const {
+    return errorStatus_;
+}
+
+RequestParser::Status RequestParser::fail(int status) {
+    errorStatus_ = status;
+    return Status::Error;
+}
+
+RequestParser::Status RequestParser::parseHead(std::span<const uint8_t> data) {
+    if (errorStatus_ != 0) {
+        return Status::Error;
+    }
+
+    const char* base = reinterpret_cast<const char*>(data.data());
+    size_t size = data.size();
+
+    if (phase_ == Phase::Head) {
+        // Tolerate Empty Lines Between Pipelined Requests
+        while (skipped_ < size && (base[skipped_] == '\r' || base[skipped_] == '\n')) {
+            ++skipped_;
+        }
+
+        if (!findHeadEnd(base + skipped_, size - skipped_)) {
+            if (size - skipped_ > MaxHeaderBytes) {
+                return fail(431);
+            }
+            return Status::Incomplete;
+        }
+
+        if (headLength_ > MaxHeaderBytes) {
+            return fail(431);
+        }
+
+        if (!parseFields(base + skipped_, headLength_)) {
+            return Status::Error;
+        }
+        parsedBase_ = base;
+        phase_ = Phase::Body;
+    }
+
+    // Buffer Moved Since the Head Was Parsed: Re-Point the Views
+    if (parsedBase_ != base) {
+        parseFields(base + skipped_, headLength_);
+        parsedBase_ = base;
+    }
+
+    return Status::Complete;
+}
+
+RequestParser::Status RequestParser::parse(std::span<const uint8_t> data) {
+    auto status = parseHead(data);
+    if (status != Status::Complete || chunked_) {
+        return status;
+    }
+
+    if (!bodyFits(bodyLength_)) {
+        return fail(413);
+    }
+
+    if (data.size() < consumed()) {
+        return Status::Incomplete;
+    }
+
+    request_.body = std::string_view(reinterpret_cast<const char*>(data.data()) + skipped_ + headLength_, bodyLength_);
+    return Status::Complete;
+}
+
+bool RequestParser::findHeadEnd(const char* data, size_t size) {
+    ByteScanner lineFeeds(data, size, "\n");
+
+    for (size_t lf = lineFeeds.next(scanOffset_); lf < size; lf = lineFeeds.next(lf + 1)) {
+        // Need the Following Byte(s) to Decide; Resume at This LF
+        if (lf + 1 >= size) {
+            scanOffset_ = lf;
+            return false;
+        }
+        if (data[lf + 1] == '\n') {
+            headLength_ = lf + 2;
+            return true;
+        }
+        if (data[lf + 1] == '\r') {
+            if (lf + 2 >= size) {
+                scanOffset_ = lf;
+                return false;
+            }
+            if (data[lf + 2] == '\n') {
+                headLength_ = lf + 3;
+                return true;
+            }
+        }
+    }
+
+    scanOffset_ = size;
+    return false;
+}
+
+bool RequestParser::parseFields(const char* data, size_t size) {
+    std::string_view head(data, size);
+
+    // Single Index Over Every Byte the Grammar Splits On
+    ByteScanner delimiters(data, size, "\n: \t");
+    auto nextOf = [&](char c, size_t from) {
+        size_t pos = delimiters.next(from);
+        while (pos < size && data[pos] != c) {
+            pos = delimiters.next(pos + 1);
+        }
+        return pos;
+    };
+    auto lineBefore = [&](size_t from, size_t lf) {
+        auto line = head.substr(from, lf - from);
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+        return line;
+    };
+
+    errorStatus_ = 400;
+
+    // Request Line: METHOD SP TARGET SP VERSION
+    size_t firstSpace = delimiters.next(0);
+    if (firstSpace == size || data[firstSpace] != ' ') return false;
+    size_t secondSpace = nextOf(' ', firstSpace + 1);
+    size_t lf = nextOf('\n', firstSpace + 1);
+    if (lf == size || secondSpace > lf) return false;
+
+    request_.method = head.substr(0, firstSpace);
+    request_.path = head.substr(firstSpace + 1, secondSpace - firstSpace - 1);
+    request_.version = lineBefore(secondSpace + 1, lf);
+    if (request_.method.empty() || request_.path.empty() || !request_.version.starts_with("HTTP/")) {
+        return false;
+    }
+
+    // Header Fields
+    headerCount_ = 0;
+    bodyLength_ = 0;
+    chunked_ = false;
+    bool sawContentLength = false;
+
+    for (size_t lineStart = lf + 1; lineStart < size; lineStart = lf + 1) {
+        // Empty Line Ends the Head
+        if (data[lineStart] == '\n') break;
+        if (data[lineStart] == '\r') {
+            if (lineStart + 1 < size && data[lineStart + 1] == '\n') break;
+            return false;
+        }
+
+        // Obsolete Line Folding is Rejected (RFC 9112 5.2)
+        if (data[lineStart] == ' ' || data[lineStart] == '\t') return false;
+
+        // Whitespace or End of Line Before the Colon is Malformed
+        size_t colon = delimiters.next(lineStart);
+        if (colon == size || data[colon] != ':' || colon == lineStart) return false;
+
+        lf = nextOf('\n', colon + 1);
+        auto name = head.substr(lineStart, colon - lineStart);
+        auto value = trimWhitespace(lineBefore(colon + 1, lf));
+
+        if (headerCount_ == MaxHeaders) {
+            errorStatus_ = 431;
+            return false;
+        }
+        headers_[headerCount_++] = HeaderView{ name, value };
+
+        if (equalsIgnoreCase(name, "Content-Length")) {
+            size_t length = 0;
+            if (!parseContentLength(value, length)) return false;
+            if (sawContentLength && length != bodyLength_) return false;
+            bodyLength_ = length;
+            sawContentLength = true;
+        }
+        else if (equalsIgnoreCase(name, "Transfer-Encoding")) {
+            // Only Plain Chunked Framing; Compressed Codings are Not Implemented
+            if (!equalsIgnoreCase(value, "chunked")) {
+                errorStatus_ = 501;
+                return false;
+            }
+            chunked_ = true;
+        }
+    }
+
+    // Both Framings at Once is a Request Smuggling Vector (RFC 9112 6.3)
+    if (chunked_ && sawContentLength) return false;
+
+    request_.headers = std::span<const HeaderView>(headers_.data(), headerCount_);
+    errorStatus_ = 0;
+    return true;
+}
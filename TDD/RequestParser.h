@@ -0,0 +1,116 @@
+#pragma once
+
+#if !defined(_WIN32)
+#define API
+#elif defined(LIB_EXPORTS)
+#define API __declspec(dllexport)
+#else
+#define API __declspec(dllimport)
+#endif
+
+#include <array>
+#include <span>
+#include <string_view>
+#include <optional>
+#include <cstdint>
+#include <cstddef>
+
+struct HeaderView {
+    std::string_view name;
+    std::string_view value;
+};
+
+// Non-Owning Request; Every View Points Into the Caller's Receive Buffer
+struct API RequestView {
+    std::string_view method;
+    std::string_view path;
+    std::string_view version;
+    std::span<const HeaderView> headers;
+    std::string_view body;
+
+    // Case-Insensitive Header Lookup
+    std::optional<std::string_view> header(std::string_view name) const;
+
+    // Connection Header if Present, Otherwise HTTP/1.1 Default
+    bool keepAlive() const;
+};
+
+// Case-Insensitive ASCII Comparison (HTTP Tokens)
+API bool equalsIgnoreCase(std::string_view a, std::string_view b);
+
+// Resumable HTTP/1.1 Request Parser
+//
+// parse() is Handed Every Unconsumed Byte Starting at the Current Request.
+// It Remembers How Far it Scanned, so Feeding a Growing Buffer Costs
+// O(new bytes). After Complete, request() is Valid Until the Buffer Changes;
+// the Caller Drops consumed() Bytes and Calls reset() for the Next Request.
+// Chunked Bodies are Not Buffered Here: parse() Completes at the End of the
+// Head and the Caller Decodes the Body With BodyDecoder.
+class API RequestParser {
+public:
+    static constexpr size_t MaxHeaders = 64;
+    static constexpr size_t MaxHeaderBytes = 64 * 1024;
+    static constexpr size_t DefaultMaxBodyBytes = 8 * 1024 * 1024;
+
+    enum class Status {
+        Complete,
+        Incomplete,
+        Error
+    };
+
+    RequestParser();
+
+    Status parse(std::span<const uint8_t> data);
+
+    // Stops at the End of the Head (request().body Empty); parse() May Follow
+    // on the Same Data to Wait for a Content-Length Body
+    Status parseHead(std::span<const uint8_t> data);
+
+    const RequestView& request() const;
+    size_t consumed() const;
+    size_t headSize() const;
+
+    // Transfer-Encoding: chunked; Body Length is Unknown Until Decoded
+    bool chunked() const;
+
+    // HTTP Status to Answer With After Error (400, 413, 431, 501)
+    int errorStatus() const;
+
+    // Larger Declared Bodies Fail With 413 Before Any Body Byte is Buffered
+    void setMaxBodySize(size_t bytes);
+    // The One Body Limit, Also Applied by the Server to Bodies it Buffers Itself
+    bool bodyFits(size_t bytes) const;
+
+    // Whether the Request's Route Streams its Body; Cached by the Caller
+    // Until reset() so the Route is Looked Up Once per Request
+    std::optional<bool> streamingRoute() const;
+    void setStreamingRoute(bool streaming);
+
+    // Clears Per-Request State; the Body Limit is Kept
+    void reset();
+
+private:
+    enum class Phase {
+        Head,
+        Body
+    };
+
+    Status fail(int status);
+    bool findHeadEnd(const char* data, size_t size);
+    bool parseFields(const char* data, size_t size);
+
+    Phase phase_;
+    size_t skipped_;        // Leading Empty Lines Ignored Before the Request Line
+    size_t scanOffset_;     // Resume Point for the Head Terminator Search
+    size_t headLength_;
+    size_t bodyLength_;
+    size_t maxBodySize_;
+    const char* parsedBase_;
+    size_t headerCount_;
+    bool chunked_;
+    int errorStatus_;
+    std::optional<bool> streamingRoute_;
+
+    std::array<HeaderView, MaxHeaders> headers_;
+    RequestView request_;
+};
@@ -0,0 +1,230 @@
+#include "Router.h"
+
+namespace {
+    struct MethodName {
+        std::string_view name;
+        HttpMethod::Mask bit;
+    };
+
+    constexpr MethodName StandardMethods[] = {
+        { "GET", HttpMethod::Get },
+        { "HEAD", HttpMethod::Head },
+        { "POST", HttpMethod::Post },
+        { "PUT", HttpMethod::Put },
+        { "DELETE", HttpMethod::Delete },
+        { "CONNECT", HttpMethod::Connect },
+        { "OPTIONS", HttpMethod::Options },
+        { "TRACE", HttpMethod::Trace },
+        { "PATCH", HttpMethod::Patch },
+    };
+
+    size_t commonPrefix(std::string_view a, std::string_view b) {
+        size_t length = a.size() < b.size() ? a.size() : b.size();
+        size_t i = 0;
+        while (i < length && a[i] == b[i]) ++i;
+        return i;
+    }
+}
+
+HttpMethod::Mask HttpMethod::fromName(std::string_view method) {
+    for (const auto& standard : StandardMethods) {
+        if (standard.name == method) {
+            return standard.bit;
+        }
+    }
+    return Other;
+}
+
+std::pmr::string HttpMethod::toAllowList(Mask methods, std::pmr::memory_resource* resource) {
+    std::pmr::string list(resource);
+    for (const auto& standard : StandardMethods) {
+        if (methods & standard.bit) {
+            if (!list.empty()) list += ", ";
+            list += standard.name;
+        }
+    }
+    return list;
+}
+
+Router::Router(std::pmr::memory_resource* resource)
+    : resource_(resource),
+    nodes_(resource),
+    root_(nullptr) {
+    root_ = newNode();
+}
+
+Router::Node* Router::newNode() {
+    return &nodes_.emplace_back(resource_);
+}
+
+size_t Router::getNodeCount() const {
+    return nodes_.size();
+}
+
+Router::Node* Router::insertLiteral(Node* node, std::string_view text) {
+    while (!text.empty()) {
+        size_t index = node->indices.find(text.front());
+        if (index == std::pmr::string::npos) {
+            Node* child = newNode();
+            child->prefix = text;
+            node->indices.push_back(text.front());
+            node->children.push_back(child);
+            return child;
+        }
+
+        Node* child = node->children[index];
+        size_t common = commonPrefix(child->prefix, text);
+
+        // Split the Edge: child Keeps the Shared Part, a New Node Takes the Rest
+        if (common < child->prefix.size()) {
+            Node* tail = newNode();
+            tail->prefix = child->prefix.substr(common);
+            tail->indices = std::move(child->indices);
+            tail->children = std::move(child->children);
+            tail->paramChild = child->paramChild;
+            tail->wildcardChild = child->wildcardChild;
+            tail->entries = std::move(child->entries);
+
+            child->prefix.resize(common);
+            child->indices.assign(1, tail->prefix.front());
+            child->children.assign(1, tail);
+            child->paramChild = nullptr;
+            child->wildcardChild = nullptr;
+            child->entries.clear();
+        }
+
+        text.remove_prefix(common);
+        node = child;
+    }
+    return node;
+}
+
+bool Router::add(std::string_view pattern, HttpMethod::Mask methods, uint32_t routeId) {
+    if (pattern.empty() || methods == 0) {
+        return false;
+    }
+
+    // Syntax is Checked Before Anything is Inserted
+    size_t paramCount = 0;
+    for (size_t pos = 0; pos < pattern.size(); ++pos) {
+        if (pattern[pos] == '{') {
+            size_t close = pattern.find('}', pos);
+            if (close == std::string_view::npos || close == pos + 1) return false;
+            if (pattern.substr(pos + 1, close - pos - 1).find_first_of("{/*") != std::string_view::npos) return false;
+            if (close + 1 < pattern.size() && pattern[close + 1] != '/') return false;
+            if (++paramCount > MaxParams) return false;
+            pos = close;
+        }
+        else if (pattern[pos] == '*') {
+            if (pattern.substr(pos + 1).find_first_of("{}/*") != std::string_view::npos) return false;
+            if (++paramCount > MaxParams) return false;
+            break;
+        }
+        else if (pattern[pos] == '}') {
+            return false;
+        }
+    }
+
+    // A Parameter Name Clash Found Mid-Walk Can Leave Literal Nodes Without
+    // Entries Behind; They Never Match, so Only the Clashing Route is Lost
+    Node* node = root_;
+    std::string_view rest = pattern;
+    while (!rest.empty()) {
+        size_t special = rest.find_first_of("{*");
+        node = insertLiteral(node, rest.substr(0, special));
+        if (special == std::string_view::npos) {
+            break;
+        }
+        rest.remove_prefix(special);
+
+        if (rest.front() == '{') {
+            size_t close = rest.find('}');
+            std::string_view name = rest.substr(1, close - 1);
+            if (!node->paramChild) {
+                node->paramChild = newNode();
+                node->paramChild->name = name;
+            }
+            else if (node->paramChild->name != name) {
+                return false;
+            }
+            node = node->paramChild;
+            rest.remove_prefix(close + 1);
+        }
+        else {
+            std::string_view name = rest.substr(1);
+            if (!node->wildcardChild) {
+                node->wildcardChild = newNode();
+                node->wildcardChild->name = name;
+            }
+            else if (node->wildcardChild->name != name) {
+                return false;
+            }
+            node = node->wildcardChild;
+            rest = {};
+        }
+    }
+
+    node->entries.push_back(Entry{ methods, routeId });
+    return true;
+}
+
+bool Router::matchEntries(const Node* node, HttpMethod::Mask method, Match& match) const {
+    for (const auto& entry : node->entries) {
+        match.pathMethods |= entry.methods;
+        if (entry.methods & method) {
+            match.found = true;
+            match.routeId = entry.routeId;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Router::findFrom(const Node* node, std::string_view path, HttpMethod::Mask method, Match& match) const {
+    if (path.empty()) {
+        if (matchEntries(node, method, match)) {
+            return true;
+        }
+    }
+    else {
+        // Literal Edge (At Most One Child Can Start With This Byte)
+        size_t index = node->indices.find(path.front());
+        if (index != std::pmr::string::npos) {
+            const Node* child = node->children[index];
+            if (path.starts_with(child->prefix) &&
+                findFrom(child, path.substr(child->prefix.size()), method, match)) {
+                return true;
+            }
+        }
+
+        // Parameter: One Non-Empty Segment
+        if (node->paramChild && match.paramCount < MaxParams) {
+            size_t end = path.find('/');
+            std::string_view value = path.substr(0, end);
+            if (!value.empty()) {
+                match.params[match.paramCount++] = Param{ node->paramChild->name, value };
+                if (findFrom(node->paramChild, path.substr(value.size()), method, match)) {
+                    return true;
+                }
+                --match.paramCount;
+            }
+        }
+    }
+
+    // Wildcard: Everything Left (Possibly Nothing)
+    if (node->wildcardChild && match.paramCount < MaxParams) {
+        match.params[match.paramCount++] = Param{ node->wildcardChild->name, path };
+        if (matchEntries(node->wildcardChild, method, match)) {
+            return true;
+        }
+        --match.paramCount;
+    }
+
+    return false;
+}
+
+Router::Match Router::find(std::string_view path, HttpMethod::Mask method) const {
+    Match match;
+    findFrom(root_, path, method, match);
+    return match;
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#if !defined(_WIN32)
+#define API
+#elif defined(LIB_EXPORTS)
+#define API __declspec(dllexport)
+#else
+#define API __declspec(dllimport)
+#endif
+
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+// Request Methods as Bits so a Route's Method Set is One Mask Test
+namespace HttpMethod {
+    using Mask = uint16_t;
+
+    constexpr Mask Get = 1 << 0;
+    constexpr Mask Head = 1 << 1;
+    constexpr Mask Post = 1 << 2;
+    constexpr Mask Put = 1 << 3;
+    constexpr Mask Delete = 1 << 4;
+    constexpr Mask Connect = 1 << 5;
+    constexpr Mask Options = 1 << 6;
+    constexpr Mask Trace = 1 << 7;
+    constexpr Mask Patch = 1 << 8;
+    constexpr Mask Other = 1 << 15;   // Any Extension Method
+    constexpr Mask Any = 0xFFFF;
+
+    // Exact (Case-Sensitive) Method Token to its Bit; Unknown Tokens Map to Other
+    API Mask fromName(std::string_view method);
+
+    // "GET, POST" Style List of the Standard Methods in a Mask
+    API std::pmr::string toAllowList(Mask methods, std::pmr::memory_resource* resource);
+}
+
+// Compressed Radix Tree Mapping (Path, Method) to a Route Id
+//
+// Patterns are Literal Text With Optional "{name}" Segments (One Path
+// Segment Each) and an Optional Trailing "*" or "*name" Wildcard That
+// Captures the Rest of the Path. On Lookup, Literal Edges Win Over
+// Parameters, Which Win Over Wildcards; the Walk Backtracks if a More
+// Specific Branch Dead-Ends. Lookup Cost is O(Path Length) and Allocates
+// Nothing; Captured Values are Views Into the Looked-Up Path.
+class API Router {
+public:
+    static constexpr size_t MaxParams = 8;
+
+    struct Param {
+        std::string_view name;
+        std::string_view value;
+    };
+
+    struct Match {
+        bool found = false;
+        uint32_t routeId = 0;
+
+        // Union of Methods Registered on Every Node the Path Reached (for 405 Allow)
+        HttpMethod::Mask pathMethods = 0;
+
+        std::array<Param, MaxParams> params{};
+        size_t paramCount = 0;
+    };
+
+    explicit Router(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    // False if the Pattern is Malformed or Names a Parameter Differently Than
+    // an Existing Route at the Same Position
+    bool add(std::string_view pattern, HttpMethod::Mask methods, uint32_t routeId);
+
+    // Query String (if Any) Must Already be Stripped
+    Match find(std::string_view path, HttpMethod::Mask method) const;
+
+    size_t getNodeCount() const;
+
+    // Deleted Copy/Move Ops (Nodes Point at Each Other)
+    Router(const Router&) = delete;
+    Router& operator=(const Router&) = delete;
+    Router(Router&&) = delete;
+    Router& operator=(Router&&) = delete;
+
+private:
+    struct Entry {
+        HttpMethod::Mask methods;
+        uint32_t routeId;
+    };
+
+    struct Node {
+        std::pmr::string prefix;        // Literal Edge Label (Empty for Parameter/Wildcard Nodes)
+        std::pmr::string indices;       // First Byte of Each Literal Child, Parallel to children
+        std::pmr::vector<Node*> children;
+        Node* paramChild = nullptr;
+        Node* wildcardChild = nullptr;
+        std::pmr::string name;          // Parameter/Wildcard Name
+        std::pmr::vector<Entry> entries;
+
+        explicit Node(std::pmr::memory_resource* resource)
+            : prefix(resource), indices(resource), children(resource), name(resource), entries(resource) {
+        }
+    };
+
+    Node* newNode();
+    Node* insertLiteral(Node* node, std::string_view text);
+    bool findFrom(const Node* node, std::string_view path, HttpMethod::Mask method, Match& match) const;
+    bool matchEntries(const Node* node, HttpMethod::Mask method, Match& match) const;
+
+    std::pmr::memory_resource* resource_;
+    std::pmr::deque<Node> nodes_;       // Stable Addresses
+    Node* root_;
+};
@@ -0,0 +1,159 @@
+#include "RpcFrame.h"
+
+namespace {
+    // MessagePack Format Markers Used by the Envelope
+    constexpr uint8_t PositiveFixIntMax = 0x7f;
+    constexpr uint8_t Bin8 = 0xc4;
+    constexpr uint8_t Bin16 = 0xc5;
+    constexpr uint8_t Bin32 = 0xc6;
+    constexpr uint8_t Uint8 = 0xcc;
+    constexpr uint8_t Uint16 = 0xcd;
+    constexpr uint8_t Uint32 = 0xce;
+    constexpr uint8_t Uint64 = 0xcf;
+
+    uint8_t* writeBigEndian(uint8_t* out, uint64_t value, size_t bytes) {
+        for (size_t i = bytes; i > 0; --i) {
+            *out++ = static_cast<uint8_t>(value >> ((i - 1) * 8));
+        }
+        return out;
+    }
+
+    uint64_t readBigEndian(const uint8_t* in, size_t bytes) {
+        uint64_t value = 0;
+        for (size_t i = 0; i < bytes; ++i) {
+            value = (value << 8) | in[i];
+        }
+        return value;
+    }
+
+    uint8_t* writeUint(uint8_t* out, uint64_t value) {
+        if (value <= PositiveFixIntMax) {
+            *out++ = static_cast<uint8_t>(value);
+            return out;
+        }
+        if (value <= UINT8_MAX) {
+            *out++ = Uint8;
+            return writeBigEndian(out, value, 1);
+        }
+        if (value <= UINT16_MAX) {
+            *out++ = Uint16;
+            return writeBigEndian(out, value, 2);
+        }
+        if (value <= UINT32_MAX) {
+            *out++ = Uint32;
+            return writeBigEndian(out, value, 4);
+        }
+        *out++ = Uint64;
+        return writeBigEndian(out, value, 8);
+    }
+
+    // Reads Within [pos, end); False on a Truncated or Non-Uint Value
+    bool readUint(const uint8_t*& pos, const uint8_t* end, uint64_t& value) {
+        if (pos == end) return false;
+
+        uint8_t marker = *pos++;
+        if (marker <= PositiveFixIntMax) {
+            value = marker;
+            return true;
+        }
+
+        size_t bytes;
+        switch (marker) {
+        case Uint8: bytes = 1; break;
+        case Uint16: bytes = 2; break;
+        case Uint32: bytes = 4; break;
+        case Uint64: bytes = 8; break;
+        default: return false;
+        }
+
+        if (static_cast<size_t>(end - pos) < bytes) return false;
+        value = readBigEndian(pos, bytes);
+        pos += bytes;
+        return true;
+    }
+
+    bool readBinLength(const uint8_t*& pos, const uint8_t* end, uint64_t& length) {
+        if (pos == end) return false;
+
+        size_t bytes;
+        switch (*pos++) {
+        case Bin8: bytes = 1; break;
+        case Bin16: bytes = 2; break;
+        case Bin32: bytes = 4; break;
+        default: return false;
+        }
+
+        if (static_cast<size_t>(end - pos) < bytes) return false;
+        length = readBigEndian(pos, bytes);
+        pos += bytes;
+        return true;
+    }
+}
+
+size_t RpcFrameCodec::encodeHeader(const RpcFrame& frame, std::span<uint8_t, MaxHeaderBytes> header) {
+    // Envelope First; the Prefix is Filled Once its Size is Known
+    uint8_t* start = header.data();
+    uint8_t* out = start + PrefixBytes;
+    out = writeUint(out, frame.methodId);
+    out = writeUint(out, frame.requestId);
+    out = writeUint(out, static_cast<uint8_t>(frame.status));
+
+    size_t payloadSize = frame.payload.size();
+    if (payloadSize <= UINT8_MAX) {
+        *out++ = Bin8;
+        out = writeBigEndian(out, payloadSize, 1);
+    }
+    else if (payloadSize <= UINT16_MAX) {
+        *out++ = Bin16;
+        out = writeBigEndian(out, payloadSize, 2);
+    }
+    else {
+        *out++ = Bin32;
+        out = writeBigEndian(out, payloadSize, 4);
+    }
+
+    size_t headerSize = static_cast<size_t>(out - start);
+    writeBigEndian(start, headerSize - PrefixBytes + payloadSize, PrefixBytes);
+    return headerSize;
+}
+
+RpcFrameCodec::Result RpcFrameCodec::decode(std::span<const uint8_t> input, size_t maxFrameBytes) {
+    Result result{ Status::Incomplete, 0, {} };
+    if (input.size() < PrefixBytes) {
+        return result;
+    }
+
+    uint64_t length = readBigEndian(input.data(), PrefixBytes);
+    if (length > maxFrameBytes) {
+        result.status = Status::Error;
+        return result;
+    }
+    if (input.size() - PrefixBytes < length) {
+        return result;
+    }
+
+    // Every Field Must Lie Inside the Frame and the Payload Must End it Exactly
+    const uint8_t* pos = input.data() + PrefixBytes;
+    const uint8_t* end = pos + length;
+    uint64_t methodId, requestId, status, payloadSize;
+    bool valid = readUint(pos, end, methodId)
+        && readUint(pos, end, requestId)
+        && readUint(pos, end, status)
+        && readBinLength(pos, end, payloadSize)
+        && methodId <= UINT32_MAX
+        && status <= UINT8_MAX
+        && payloadSize == static_cast<uint64_t>(end - pos);
+
+    if (!valid) {
+        result.status = Status::Error;
+        return result;
+    }
+
+    result.status = Status::Complete;
+    result.consumed = PrefixBytes + static_cast<size_t>(length);
+    result.frame.methodId = static_cast<uint32_t>(methodId);
+    result.frame.requestId = requestId;
+    result.frame.status = static_cast<RpcStatus>(status);
+    result.frame.payload = std::span<const uint8_t>(pos, static_cast<size_t>(payloadSize));
+    return result;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#if !defined(_WIN32)
+#define API
+#elif defined(LIB_EXPORTS)
+#define API __declspec(dllexport)
+#else
+#define API __declspec(dllimport)
+#endif
+
+#include <span>
+#include <cstdint>
+#include <cstddef>
+
+// Outcome Carried by Every Response Frame (Requests Send Ok)
+enum class RpcStatus : uint8_t {
+    Ok = 0,
+    UnknownMethod = 1,  // No Handler Registered Under the Method Id
+    BadRequest = 2,     // Parameters Did Not Decode
+    HandlerError = 3    // Handler Threw
+};
+
+// One Call or Reply; payload is the MessagePack-Encoded Parameters or Result
+struct RpcFrame {
+    uint32_t methodId = 0;
+    uint64_t requestId = 0;
+    RpcStatus status = RpcStatus::Ok;
+    std::span<const uint8_t> payload;
+};
+
+// Wire Format Shared by RpcServer and its Clients
+//
+//   uint32 Big-Endian Length of Everything After it, Then the MessagePack
+//   Values methodId (uint), requestId (uint), status (uint) and payload (bin).
+//
+// Integers Take Their Shortest MessagePack Form, as msgpack::pack Writes
+// Them. The Envelope is Coded Here Directly so the Payload is Never Copied:
+// encode() Writes Only the Header and the Payload Goes Out as its Own
+// Segment; decode() Returns it as a View Into the Input.
+class API RpcFrameCodec {
+public:
+    static constexpr size_t PrefixBytes = 4;
+    // Prefix + uint32 + uint64 + Status + bin32 Marker
+    static constexpr size_t MaxHeaderBytes = PrefixBytes + 5 + 9 + 1 + 5;
+    static constexpr size_t DefaultMaxFrameBytes = 8 * 1024 * 1024;
+
+    enum class Status {
+        Complete,       // frame Holds a Whole Frame; Advance by consumed
+        Incomplete,     // Needs More Input
+        Error           // Malformed or Over the Size Limit (Drop the Connection)
+    };
+
+    struct Result {
+        Status status;
+        size_t consumed;
+        RpcFrame frame;
+    };
+
+    // Header for frame (Sized From frame.payload); Returns Bytes Written
+    static size_t encodeHeader(const RpcFrame& frame, std::span<uint8_t, MaxHeaderBytes> header);
+
+    // maxFrameBytes Bounds the Length Prefix, so Oversized Frames Fail Before They Buffer
+    static Result decode(std::span<const uint8_t> input, size_t maxFrameBytes = DefaultMaxFrameBytes);
+};
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "RpcFrame.h"
+#include "msgpack/msgpack.hpp"
+#include <memory_resource>
+#include <vector>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+// Method Id for a Name (32-Bit FNV-1a); Callers and Servers Derive it the
+// Same Way, so Names Never Travel on the Wire
+constexpr uint32_t rpcMethodId(std::string_view name) {
+    uint32_t hash = 2166136261u;
+    for (char c : name) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Structs Following the msgpack pack(T&) Member Convention
+template<class T>
+concept MsgPackObject = std::is_default_constructible_v<T> &&
+    requires(T& value, msgpack::Packer& packer, msgpack::Unpacker& unpacker) {
+        value.pack(packer);
+        value.pack(unpacker);
+    };
+
+// Decode, Call, Encode. Instantiated per Handler Type, so the Handler Call
+// is Direct and the Parameters Unpack Straight Into Req. The Packer Owns its
+// Buffer, so the Encoding is Copied Once Into result; a Packer Kept per
+// Thread Holds its Capacity, Leaving No Allocation but result's Own
+template<MsgPackObject Req, MsgPackObject Resp, class Fn>
+    requires std::is_invocable_r_v<Resp, Fn&, Req&>
+RpcStatus invokeRpc(Fn& fn, std::span<const uint8_t> params, std::pmr::vector<uint8_t>& result) {
+    std::error_code ec;
+    auto request = msgpack::unpack<Req>(params.data(), params.size(), ec);
+    if (ec) {
+        return RpcStatus::BadRequest;
+    }
+
+    Resp response = fn(request);
+    thread_local msgpack::Packer packer;
+    packer.clear();
+    response.pack(packer);
+    result.assign(packer.vector().begin(), packer.vector().end());
+    return RpcStatus::Ok;
+}
+
+// Method Name Usable as a Template Argument
+template<size_t N>
+struct RpcName {
+    char text[N];
+
+    constexpr RpcName(const char (&name)[N]) {
+        for (size_t i = 0; i < N; ++i) text[i] = name[i];
+    }
+
+    constexpr std::string_view view() const {
+        return std::string_view(text, N - 1);
+    }
+};
+
+// Req and Resp Read Off a Handler's Signature: Resp(Req&) or Resp(const Req&)
+template<class Fn>
+struct RpcSignature : RpcSignature<decltype(&Fn::operator())> {};
+
+template<class R, class A>
+struct RpcSignature<R(*)(A)> {
+    using Request = std::remove_cvref_t<A>;
+    using Response = R;
+};
+
+template<class C, class R, class A>
+struct RpcSignature<R(C::*)(A) const> : RpcSignature<R(*)(A)> {};
+
+// One Entry of a Compile-Time Method Table; Fn is a Function Pointer or Captureless Lambda
+template<RpcName Name, auto Fn>
+struct RpcMethod {
+    using Request = typename RpcSignature<decltype(Fn)>::Request;
+    using Response = typename RpcSignature<decltype(Fn)>::Response;
+
+    static constexpr std::string_view name = Name.view();
+    static constexpr uint32_t id = rpcMethodId(Name.view());
+
+    static RpcStatus invoke(std::span<const uint8_t> params, std::pmr::vector<uint8_t>& result) {
+        auto fn = Fn;
+        return invokeRpc<Request, Response>(fn, params, result);
+    }
+};
+
+// Method Table Fixed at Compile Time. dispatch() Compares the Id Against
+// Each Method in Turn and Calls the Match Directly: No Map, No Erased Calls
+template<class... Methods>
+struct RpcService {
+    static consteval bool idsAreUnique() {
+        constexpr uint32_t ids[] = { Methods::id..., 0 };
+        for (size_t i = 0; i < sizeof...(Methods); ++i) {
+            for (size_t j = i + 1; j < sizeof...(Methods); ++j) {
+                if (ids[i] == ids[j]) return false;
+            }
+        }
+        return true;
+    }
+
+    static_assert(idsAreUnique(), "Two methods hash to the same id; rename one");
+
+    static RpcStatus dispatch(uint32_t methodId, std::span<const uint8_t> params, std::pmr::vector<uint8_t>& result) {
+        RpcStatus status = RpcStatus::UnknownMethod;
+        (void)((methodId == Methods::id && (status = Methods::invoke(params, result), true)) || ...);
+        return status;
+    }
+};
@@ -0,0 +1,485 @@
+#include "RpcServer.h"
+#include <iostream>
+#include <algorithm>
+#include <array>
+
+namespace {
+    // Upper Bound on How Long Blocked Threads Take to Notice stop()
+    constexpr std::chrono::milliseconds ReadablePollInterval(100);
+}
+
+RpcServer::RpcServer(
+    std::unique_ptr<Socket, PMRDeleter<Socket>> socket,
+    std::shared_ptr<BumpMemoryManager> memoryManager,
+    Config config
+) :
+    running_(false),
+    socket_(std::move(socket)),
+    acceptEngine_(IOEngine::createDefault()),
+    memoryManager_(std::move(memoryManager)),
+    serverResource_(memoryManager_->getResource()),
+    methods_(serverResource_),
+    service_(nullptr),
+    workers_(serverResource_),
+    calls_(serverResource_),
+    workersStopping_(false),
+    clientSessions_(serverResource_),
+    reapSignal_(false),
+    config_(config)
+{
+}
+
+RpcServer::~RpcServer() {
+    stop();
+}
+
+SocketError RpcServer::start(const std::pmr::string& address, uint16_t port) {
+    auto initResult = socket_->init();
+    if (initResult.type != SocketError::Type::None) {
+        return initResult;
+    }
+
+    auto bindResult = socket_->bind(address, port);
+    if (bindResult.type != SocketError::Type::None) {
+        return bindResult;
+    }
+
+    auto listenResult = socket_->listen(100);
+    if (listenResult.type != SocketError::Type::None) {
+        return listenResult;
+    }
+
+    // Edge-Triggered Listener Readiness Where an Engine Exists
+    if (acceptEngine_) {
+        auto engineResult = acceptEngine_->init();
+        if (engineResult.type == SocketError::Type::None) {
+            socket_->setNonBlocking();
+            engineResult = acceptEngine_->add(*socket_,
+                IOEngine::Readable | IOEngine::EdgeTriggered, socket_.get());
+        }
+        if (engineResult.type != SocketError::Type::None) {
+            return engineResult;
+        }
+    }
+
+    running_ = true;
+
+    // One Worker per Core Unless Configured Otherwise
+    size_t workerCount = config_.workerCount;
+    if (workerCount == 0) {
+        workerCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    workersStopping_ = false;
+    for (size_t i = 0; i < workerCount; ++i) {
+        workers_.emplace_back(&RpcServer::workerThreadHandler, this);
+    }
+
+    cleanupThread_ = std::thread(&RpcServer::cleanupThreadHandler, this);
+    acceptThread_ = std::thread(&RpcServer::acceptThreadHandler, this);
+
+    return SocketError::success();
+}
+
+void RpcServer::stop() {
+    if (!running_) return;
+
+    running_ = false;
+
+    if (acceptEngine_) {
+        acceptEngine_->wakeup();
+    }
+
+    reapSignal_.store(true);
+    reapSignal_.notify_one();
+
+    if (cleanupThread_.joinable()) {
+        cleanupThread_.join();
+    }
+
+    if (acceptThread_.joinable()) {
+        acceptThread_.join();
+    }
+
+    // Readers Wait Out Their Queued Calls, so Workers Must Outlive Them
+    cleanupSessions();
+
+    {
+        std::lock_guard<std::mutex> lock(callsMutex_);
+        workersStopping_ = true;
+    }
+    callsReady_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+    workers_.clear();
+
+    socket_->close();
+    socket_->cleanup();
+}
+
+void RpcServer::registerMethod(uint32_t methodId, RpcHandler handler) {
+    methods_[methodId] = std::move(handler);
+}
+
+void RpcServer::cleanupSessions() {
+    std::lock_guard<std::mutex> lock(clientSessionsMutex_);
+
+    // Destroying a Session Joins its Thread; All Observe running_ == false
+    clientSessions_.clear();
+    finishedSessions_.reset();
+}
+
+void RpcServer::reapFinishedSessions() {
+    ClientSession* finished = finishedSessions_.drain();
+    if (!finished) return;
+
+    std::lock_guard<std::mutex> lock(clientSessionsMutex_);
+    while (finished) {
+        ClientSession* next = finished->queueNext;
+        clientSessions_.erase(finished);
+        finished = next;
+    }
+}
+
+void RpcServer::handleClient(ClientSession& session) {
+    auto clientSocket = session.getSocket();
+    auto& input = session.getInputBuffer();
+    Connection connection(*clientSocket, session.getResource());
+
+    while (running_ && session.isActive() && !connection.broken) {
+        try {
+            // Queued Replies Go Out Before Any New Call is Read, so a Peer
+            // That Stops Reading Stops Being Read Too
+            bool backlogged;
+            {
+                std::lock_guard<std::mutex> lock(connection.sendMutex);
+                backlogged = !connection.pending.empty();
+            }
+            if (backlogged) {
+                auto writable = clientSocket->waitWritable(ReadablePollInterval);
+                if (!writable.has_value() || (writable.value() && !flushPending(connection))) {
+                    break;
+                }
+                continue;
+            }
+
+            // Backpressure: Stop Reading While Too Many Calls are Outstanding
+            {
+                std::unique_lock<std::mutex> lock(connection.callsMutex);
+                if (connection.inFlight >= config_.maxInFlightPerConnection) {
+                    connection.callFinished.wait_for(lock, ReadablePollInterval);
+                    continue;
+                }
+            }
+
+            // Block Until Data Arrives; Timeout Only Re-Checks running_
+            auto readable = clientSocket->waitReadable(ReadablePollInterval);
+            if (!readable.has_value()) {
+                break;
+            }
+            if (!readable.value()) {
+                continue;
+            }
+
+            // No Room Left Means a Frame Outgrew the Limit Without Completing
+            auto space = input.writable(ClientSession::ReadChunkSize);
+            if (space.empty()) {
+                break;
+            }
+            auto receiveResult = clientSocket->receiveInto(space);
+
+            // Spurious Wakeup Continues; Real Errors End the Session
+            if (!receiveResult.has_value()) {
+                if (receiveResult.error().type == SocketError::Type::WouldBlock) {
+                    continue;
+                }
+                break;
+            }
+
+            // Connection Closed
+            if (receiveResult.value() == 0) {
+                break;
+            }
+
+            session.updateLastActivityTime();
+
+            // Buffer; a Frame May Span Reads or Share One With Others
+            input.commit(receiveResult.value());
+
+            // No Way to Resynchronize After a Bad Frame, so the Connection Ends
+            if (!processFrames(connection, input)) {
+                std::cerr << "Malformed RPC frame; closing connection" << std::endl;
+                break;
+            }
+        }
+        catch (const std::exception& e) {
+            std::cerr << "RPC client handler exception: " << e.what() << std::endl;
+            break;
+        }
+        catch (...) {
+            std::cerr << "Unknown exception in RPC client handler" << std::endl;
+            break;
+        }
+    }
+
+    // Queued Calls Reference the Connection; Let Them Finish First
+    {
+        std::unique_lock<std::mutex> lock(connection.callsMutex);
+        connection.callFinished.wait(lock, [&connection] { return connection.inFlight == 0; });
+    }
+
+    session.markInactive();
+
+    // Hand to the Reaper; Only the Empty -> Non-Empty Transition Needs a Wakeup
+    if (finishedSessions_.push(&session)) {
+        reapSignal_.store(true);
+        reapSignal_.notify_one();
+    }
+}
+
+bool RpcServer::processFrames(Connection& connection, ConnectionBuffer& input) {
+    size_t offset = 0;
+    size_t queued = 0;
+    bool valid = true;
+
+    while (true) {
+        auto result = RpcFrameCodec::decode(input.readable().subspan(offset), config_.maxFrameSize);
+        if (result.status == RpcFrameCodec::Status::Incomplete) {
+            break;
+        }
+        if (result.status == RpcFrameCodec::Status::Error) {
+            valid = false;
+            break;
+        }
+        offset += result.consumed;
+
+        // Parameters are Copied Out; the Input Buffer is Reused by the Next Read
+        auto call = make_pmr_unique_ptr<Call>(connection.resource, &connection, result.frame);
+        {
+            std::lock_guard<std::mutex> lock(connection.callsMutex);
+            ++connection.inFlight;
+        }
+        {
+            std::lock_guard<std::mutex> lock(callsMutex_);
+            calls_.push_back(std::move(call));
+        }
+        ++queued;
+    }
+
+    // One Wakeup per Worker That Has Something to Do
+    if (queued == 1) {
+        callsReady_.notify_one();
+    }
+    else if (queued > 1) {
+        callsReady_.notify_all();
+    }
+
+    input.consume(offset);
+    return valid;
+}
+
+void RpcServer::execute(Connection& connection, uint32_t methodId, uint64_t requestId, std::span<const uint8_t> params) {
+    RpcFrame reply;
+    reply.methodId = methodId;
+    reply.requestId = requestId;
+
+    std::pmr::vector<uint8_t> result(connection.resource);
+    try {
+        reply.status = service_ ? service_(methodId, params, result) : RpcStatus::UnknownMethod;
+        if (reply.status == RpcStatus::UnknownMethod) {
+            auto method = methods_.find(methodId);
+            if (method != methods_.end()) {
+                reply.status = method->second(params, result);
+            }
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "RPC handler exception: " << e.what() << std::endl;
+        reply.status = RpcStatus::HandlerError;
+    }
+    catch (...) {
+        std::cerr << "Unknown exception in RPC handler" << std::endl;
+        reply.status = RpcStatus::HandlerError;
+    }
+
+    if (reply.status == RpcStatus::Ok) {
+        reply.payload = result;
+    }
+    sendReply(connection, reply);
+}
+
+void RpcServer::sendReply(Connection& connection, const RpcFrame& reply) {
+    // Header From the Stack; the Result Goes Out as its Own Segment
+    std::array<uint8_t, RpcFrameCodec::MaxHeaderBytes> header;
+    size_t headerSize = RpcFrameCodec::encodeHeader(reply, header);
+
+    std::array<std::span<const uint8_t>, 2> segments = {
+        std::span<const uint8_t>(header.data(), headerSize),
+        reply.payload
+    };
+
+    // Segments Less Their First skip Bytes
+    auto remaining = [&segments](size_t skip) {
+        auto rest = segments;
+        for (auto& segment : rest) {
+            size_t skipped = std::min(skip, segment.size());
+            segment = segment.subspan(skipped);
+            skip -= skipped;
+        }
+        return rest;
+    };
+
+    std::lock_guard<std::mutex> lock(connection.sendMutex);
+    if (connection.broken) {
+        return;
+    }
+
+    // Behind Queued Bytes the Frame Queues Whole, Keeping Frames in Order
+    size_t sent = 0;
+    if (connection.pending.empty()) {
+        size_t total = headerSize + reply.payload.size();
+        while (sent < total) {
+            auto result = connection.socket.sendvSome(remaining(sent));
+            if (!result.has_value()) {
+                if (result.error().type == SocketError::Type::WouldBlock) {
+                    break;
+                }
+                connection.broken = true;
+                return;
+            }
+            sent += result.value();
+        }
+    }
+
+    for (auto segment : remaining(sent)) {
+        connection.pending.insert(connection.pending.end(), segment.begin(), segment.end());
+    }
+}
+
+bool RpcServer::flushPending(Connection& connection) {
+    std::lock_guard<std::mutex> lock(connection.sendMutex);
+
+    size_t sent = 0;
+    while (sent < connection.pending.size()) {
+        auto result = connection.socket.sendSome(std::span<const uint8_t>(connection.pending).subspan(sent));
+        if (!result.has_value()) {
+            if (result.error().type == SocketError::Type::WouldBlock) {
+                break;
+            }
+            connection.broken = true;
+            return false;
+        }
+        sent += result.value();
+    }
+
+    connection.pending.erase(connection.pending.begin(), connection.pending.begin() + sent);
+    return true;
+}
+
+void RpcServer::workerThreadHandler() {
+    while (true) {
+        CallPtr call(nullptr, PMRDeleter<Call>(serverResource_));
+        {
+            std::unique_lock<std::mutex> lock(callsMutex_);
+            callsReady_.wait(lock, [this] { return !calls_.empty() || workersStopping_; });
+            if (calls_.empty()) {
+                return;
+            }
+            call = std::move(calls_.front());
+            calls_.pop_front();
+        }
+
+        Connection& connection = *call->connection;
+        execute(connection, call->methodId, call->requestId, call->params);
+
+        // Freed Before the Count Drops: the Reader May Release the Arena at Zero
+        call.reset();
+
+        std::lock_guard<std::mutex> lock(connection.callsMutex);
+        --connection.inFlight;
+        connection.callFinished.notify_all();
+    }
+}
+
+void RpcServer::acceptThreadHandler() {
+    if (!acceptEngine_) {
+        socket_->setTimeout();
+        socket_->setNonBlocking();
+
+        while (running_) {
+            auto readable = socket_->waitReadable(ReadablePollInterval);
+            if (readable.has_value() && readable.value() &&
+                acceptPendingClients() == AcceptDrain::Exhausted) {
+                // Still Readable, so Waiting Again Would Return at Once
+                std::this_thread::sleep_for(AcceptRetryInterval);
+            }
+        }
+        return;
+    }
+
+    IOEvent events[1];
+    int timeoutMs = -1;
+    while (running_) {
+        auto waitResult = acceptEngine_->wait(events, timeoutMs);
+        if (!waitResult.has_value()) {
+            std::cerr << "Accept engine wait failed: " << waitResult.error().internalCode << std::endl;
+            break;
+        }
+
+        if (!running_) {
+            break;
+        }
+
+        // Edge-Triggered: Drain Every Pending Connection; Retried on a Timer
+        // While Out of Descriptors, as in HTTPServer
+        if (waitResult.value() > 0 || timeoutMs >= 0) {
+            bool exhausted = acceptPendingClients() == AcceptDrain::Exhausted;
+            timeoutMs = exhausted ? static_cast<int>(AcceptRetryInterval.count()) : -1;
+        }
+    }
+}
+
+AcceptDrain RpcServer::acceptPendingClients() {
+    return drainAccepts(*socket_, running_, [this](std::shared_ptr<Socket> clientSocket) {
+        try {
+            // Synchronized: Workers Allocate Replies From the Connection's Arena
+            auto clientResource = memoryManager_->createClientResource(config_.sessionBufferSize, true);
+
+            // Session Arenas Exhausted and Overflow Rejects: Shed the Connection
+            if (!clientResource) {
+                clientSocket->close();
+                return;
+            }
+
+            auto session = make_pmr_unique_ptr<ClientSession>(
+                serverResource_,
+                clientSocket,
+                std::move(clientResource),
+                [this](ClientSession& session) { this->handleClient(session); }
+            );
+
+            // Room for the Largest Frame Plus the Read That Completes It
+            session->getInputBuffer().setLimit(config_.maxFrameSize + ClientSession::ReadChunkSize);
+
+            std::lock_guard<std::mutex> lock(clientSessionsMutex_);
+            auto* raw = session.get();
+            clientSessions_.emplace(raw, std::move(session));
+            raw->start();
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Failed to create RPC session: " << e.what() << std::endl;
+        }
+        catch (...) {
+            std::cerr << "Unknown error creating RPC session" << std::endl;
+        }
+    });
+}
+
+void RpcServer::cleanupThreadHandler() {
+    while (running_) {
+        // Sleep Until a Session Finishes (or stop() Signals)
+        reapSignal_.wait(false);
+        reapSignal_.store(false);
+        reapFinishedSessions();
+    }
+}
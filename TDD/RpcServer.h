@@ -0,0 +1,183 @@
+// RpcServer.h
+#pragma once
+
+#if !defined(_WIN32)
+#define API
+#elif defined(LIB_EXPORTS)
+#define API __declspec(dllexport)
+#else
+#define API __declspec(dllimport)
+#endif
+
+#include "Socket.h"
+#include "IOEngine.h"
+#include "ClientSession.h"
+#include "MpscQueue.h"
+#include "AcceptDrain.h"
+#include "RpcFrame.h"
+#include "RpcMethod.h"
+#include "BumpMemoryManager.h"
+#include "PMRDeleter.h"
+#include <memory>
+#include <memory_resource>
+#include <functional>
+#include <unordered_map>
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <span>
+#include <string_view>
+
+struct API RpcServerConfig {
+    size_t workerCount = 0;                         // 0 = One per Hardware Thread
+    size_t maxInFlightPerConnection = 256;          // Reading Pauses Beyond This
+    size_t maxFrameSize = RpcFrameCodec::DefaultMaxFrameBytes;
+    size_t sessionBufferSize = 256 * 1024;          // Per-Connection Arena Size
+};
+
+// Binary RPC Listener: Length-Prefixed MessagePack Frames Over Raw TCP
+//
+// A Reader Thread per Connection Splits Frames and Queues Each Call to a
+// Shared Worker Pool. A Reply Leaves as Soon as its Handler Returns, so a
+// Slow Call Never Holds Up Faster Ones Behind it on the Same Connection;
+// Clients Match Replies to Calls by Request Id.
+class API RpcServer {
+public:
+    using Config = RpcServerConfig;
+
+    // Appends the MessagePack-Encoded Result; Any Status but Ok Discards it.
+    // Throwing Answers HandlerError
+    using RpcHandler = std::function<RpcStatus(std::span<const uint8_t> params, std::pmr::vector<uint8_t>& result)>;
+
+    // Whole-Service Dispatcher; Answers UnknownMethod for Ids it Does Not Own
+    using RpcDispatch = RpcStatus(*)(uint32_t methodId, std::span<const uint8_t> params, std::pmr::vector<uint8_t>& result);
+
+    RpcServer(
+        std::unique_ptr<Socket, PMRDeleter<Socket>> socket,
+        std::shared_ptr<BumpMemoryManager> memoryManager,
+        Config config = Config()
+    );
+    ~RpcServer();
+
+    SocketError start(const std::pmr::string& address, uint16_t port);
+    void stop();
+
+    // Register Before start(); a Second Handler for the Same Id Replaces the First
+    void registerMethod(uint32_t methodId, RpcHandler handler);
+
+    // Typed Handler Under a Method Name (Id From rpcMethodId); Req and Resp
+    // Follow the msgpack pack(T&) Member Convention. This is the Runtime,
+    // Type-Erased Path: the Handler Lands in methods_ Behind an RpcHandler.
+    // registerService is the Compile-Time Path With Direct Calls
+    template<MsgPackObject Req, MsgPackObject Resp, class Fn>
+    void registerRpc(std::string_view name, Fn fn) {
+        registerMethod(rpcMethodId(name),
+            [fn = std::move(fn)](std::span<const uint8_t> params, std::pmr::vector<uint8_t>& result) mutable {
+                return invokeRpc<Req, Resp>(fn, params, result);
+            });
+    }
+
+    // Compile-Time Table (an RpcService); Consulted Before Registered Methods.
+    // Register Before start()
+    template<class Service>
+    void registerService() {
+        service_ = &Service::dispatch;
+    }
+
+    // Deleted Copy/Move Ops
+    RpcServer(const RpcServer&) = delete;
+    RpcServer& operator=(const RpcServer&) = delete;
+    RpcServer(RpcServer&&) = delete;
+    RpcServer& operator=(RpcServer&&) = delete;
+
+private:
+    // Reply Side of One Connection, Shared by its Reader and the Workers
+    struct Connection {
+        Socket& socket;
+        std::pmr::memory_resource* resource;    // Synchronized: Workers Allocate From it Too
+        std::mutex sendMutex;                   // One Frame Leaves Whole Before the Next
+        std::pmr::vector<uint8_t> pending;      // Reply Bytes the Kernel Has Not Taken Yet (Under sendMutex)
+        std::atomic<bool> broken;               // A Reply Failed to Send
+
+        // Queued or Running Calls. Workers Notify Under the Mutex, so the
+        // Reader Cannot See Zero and Destroy the Connection Mid-Notify
+        std::mutex callsMutex;
+        std::condition_variable callFinished;
+        size_t inFlight;
+
+        Connection(Socket& connectionSocket, std::pmr::memory_resource* connectionResource)
+            : socket(connectionSocket), resource(connectionResource), pending(connectionResource), broken(false), inFlight(0) {
+        }
+    };
+
+    // Call Queued for a Worker; Owns a Copy of its Parameters
+    struct Call {
+        Connection* connection;
+        uint32_t methodId;
+        uint64_t requestId;
+        std::pmr::vector<uint8_t> params;
+
+        Call(Connection* callConnection, const RpcFrame& frame)
+            : connection(callConnection),
+            methodId(frame.methodId),
+            requestId(frame.requestId),
+            params(frame.payload.begin(), frame.payload.end(), callConnection->resource) {
+        }
+    };
+
+    using CallPtr = std::unique_ptr<Call, PMRDeleter<Call>>;
+
+    void handleClient(ClientSession& session);
+    // False Once the Input Holds a Malformed or Oversized Frame
+    bool processFrames(Connection& connection, ConnectionBuffer& input);
+    void execute(Connection& connection, uint32_t methodId, uint64_t requestId, std::span<const uint8_t> params);
+    // Never Waits on the Peer: Whatever the Kernel Refuses is Queued for the Reader
+    void sendReply(Connection& connection, const RpcFrame& reply);
+    // Reader Side; False Once the Socket Fails
+    bool flushPending(Connection& connection);
+
+    void workerThreadHandler();
+    void acceptThreadHandler();
+    AcceptDrain acceptPendingClients();
+    void cleanupThreadHandler();
+    void cleanupSessions();
+    void reapFinishedSessions();
+
+    // Server State
+    std::atomic<bool> running_;
+    std::unique_ptr<Socket, PMRDeleter<Socket>> socket_;
+    std::unique_ptr<IOEngine> acceptEngine_;
+
+    // Memory Management
+    std::shared_ptr<BumpMemoryManager> memoryManager_;
+    std::pmr::memory_resource* serverResource_;
+
+    // Method Id -> Handler; Read-Only Once Running
+    std::pmr::unordered_map<uint32_t, RpcHandler> methods_;
+    RpcDispatch service_;
+
+    // Worker Pool
+    std::pmr::vector<std::thread> workers_;
+    std::pmr::deque<CallPtr> calls_;
+    std::mutex callsMutex_;
+    std::condition_variable callsReady_;
+    bool workersStopping_;                          // Set Only Once Every Reader Has Exited
+
+    // Threading
+    std::thread acceptThread_;
+    std::thread cleanupThread_;
+
+    // Client Session Management
+    std::pmr::unordered_map<ClientSession*, std::unique_ptr<ClientSession, PMRDeleter<ClientSession>>> clientSessions_;
+    std::mutex clientSessionsMutex_;
+
+    // Finished Sessions Awaiting Reaping (Pushed by Their Own Threads)
+    MpscQueue<ClientSession, &ClientSession::queueNext> finishedSessions_;
+    std::atomic<bool> reapSignal_;
+
+    // Configuration
+    Config config_;
+};
@@ -1,6 +1,8 @@
 #pragma once
 
-#ifdef LIB_EXPORTS
+#if !defined(_WIN32)
+#define API
+#elif defined(LIB_EXPORTS)
 #define API __declspec(dllexport)
 #else
 #define API __declspec(dllimport)
@@ -12,6 +14,9 @@
 #include <vector>
 #include <memory>
 #include <string>
+#include <span>
+#include <chrono>
+#include <cstdint>
 
 struct API SocketError {
     enum class Type {
@@ -20,7 +25,10 @@ struct API SocketError {
         Bind,
         Connection,
         Send,
-        Receive
+        Receive,
+        WouldBlock,
+        Poll,
+        Exhausted       // Out of Descriptors or Buffers; Retrying Later Can Succeed
     };
     Type type;
     int32_t internalCode;
@@ -34,23 +42,52 @@ struct API SocketError {
 
 class API Socket {
 public:
+    // Ordered Byte Ranges Written as One Stream (iovec / WSABUF)
+    using Segments = std::span<const std::span<const uint8_t>>;
+
+    // Segments Handed to the Kernel per Scatter-Gather Call
+    static constexpr size_t MaxSendSegments = 64;
+
     virtual SocketError init() = 0;
     virtual void cleanup() = 0;
 
     // Non-PMR
     virtual SocketError listen(int backlog) = 0;
+    // Retries Interrupted Calls and Connections Aborted in the Backlog Itself
     virtual std::expected<std::shared_ptr<Socket>, SocketError> accept() = 0;
 
     // PMR
     virtual SocketError bind(const std::pmr::string& address, uint16_t port) = 0;
     virtual SocketError connect(const std::pmr::string& address, uint16_t port) = 0;
     virtual SocketError send(const std::pmr::vector<uint8_t>& data) = 0;
+    // Single Non-Looping Send; Returns Bytes Accepted by the Kernel
+    virtual std::expected<size_t, SocketError> sendSome(std::span<const uint8_t> data) = 0;
+    // Scatter-Gather Send of Every Segment in Order, Without Joining Them
+    virtual SocketError sendv(Segments segments) = 0;
+    // Single Non-Looping Scatter-Gather Send (First MaxSendSegments Segments)
+    virtual std::expected<size_t, SocketError> sendvSome(Segments segments) = 0;
     virtual std::expected<std::pmr::vector<uint8_t>, SocketError> receive(size_t maxSize) = 0;
+    // Single Read Into Caller-Owned Memory; 0 Bytes Means the Peer Closed
+    virtual std::expected<size_t, SocketError> receiveInto(std::span<uint8_t> buffer) = 0;
+
+    // Block Until Readable (true) or Timeout (false) Without Consuming Data
+    virtual std::expected<bool, SocketError> waitReadable(std::chrono::milliseconds timeout) = 0;
+    // Block Until Writable (true) or Timeout (false); a Negative Timeout Waits Indefinitely
+    virtual std::expected<bool, SocketError> waitWritable(std::chrono::milliseconds timeout) = 0;
 
     virtual void close() = 0;
     virtual int setTimeout() = 0;
+    virtual SocketError setNonBlocking() = 0;
+    // Before bind(): Listeners That All Set it Share One Port, the Kernel
+    // Spreading New Connections Across Them
+    virtual SocketError setReusePort() = 0;
+    // Unopened Socket of the Same Kind and Memory Resource
+    virtual std::shared_ptr<Socket> createSibling() const = 0;
     virtual bool isSameSocket(const std::shared_ptr<Socket>& other) const = 0;
 
+    // OS Handle (SOCKET / fd) for Readiness Engines
+    virtual intptr_t getNativeHandle() const = 0;
+
     virtual std::pmr::memory_resource* getMemoryResource() const = 0;
 
     virtual ~Socket() = default;
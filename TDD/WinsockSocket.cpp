@@ -4,10 +4,15 @@
 #include <ws2tcpip.h>
 #include <mstcpip.h>
 #include <expected>
+#include <array>
 #include <memory_resource> // Add PMR header
 
 SocketError WinsockSocket::getLastError(SocketError::Type type) {
-    return { type, static_cast<int32_t>(WSAGetLastError()) };
+    int error = WSAGetLastError();
+    if (error == WSAEWOULDBLOCK) {
+        return { SocketError::Type::WouldBlock, static_cast<int32_t>(error) };
+    }
+    return { type, static_cast<int32_t>(error) };
 }
 
 SocketError WinsockSocket::initWinsock() {
@@ -108,8 +113,22 @@ std::expected<std::shared_ptr<Socket>, SocketError> WinsockSocket::accept() {
 
     sockaddr_in clientAddr{};
     int clientAddrLen = sizeof(clientAddr);
-    SOCKET clientSocket = ::accept(sock_, reinterpret_cast<sockaddr*>(&clientAddr), &clientAddrLen);
-    if (clientSocket == INVALID_SOCKET) {
+    SOCKET clientSocket = INVALID_SOCKET;
+    while (clientSocket == INVALID_SOCKET) {
+        clientSocket = ::accept(sock_, reinterpret_cast<sockaddr*>(&clientAddr), &clientAddrLen);
+        if (clientSocket != INVALID_SOCKET) {
+            break;
+        }
+
+        int error = WSAGetLastError();
+        if (error == WSAEINTR || error == WSAECONNRESET) {
+            // Aborted While Queued: Take the Next One
+            clientAddrLen = sizeof(clientAddr);
+            continue;
+        }
+        if (error == WSAEMFILE || error == WSAENOBUFS) {
+            return std::unexpected(SocketError{ SocketError::Type::Exhausted, static_cast<int32_t>(error) });
+        }
         return std::unexpected(getLastError(SocketError::Type::Connection));
     }
 
@@ -154,6 +173,87 @@ SocketError WinsockSocket::send(const std::pmr::vector<uint8_t>& data) {
     return SocketError::success();
 }
 
+std::expected<size_t, SocketError> WinsockSocket::sendSome(std::span<const uint8_t> data) {
+    if (!initialized_) {
+        return std::unexpected(SocketError{ SocketError::Type::Initialization, 0 });
+    }
+
+    int result = ::send(sock_, reinterpret_cast<const char*>(data.data()),
+        static_cast<int>(data.size()), 0);
+
+    if (result == SOCKET_ERROR) {
+        return std::unexpected(getLastError(SocketError::Type::Send));
+    }
+
+    return static_cast<size_t>(result);
+}
+
+std::expected<size_t, SocketError> WinsockSocket::sendSegments(Segments segments, size_t index, size_t offset) {
+    std::array<WSABUF, MaxSendSegments> buffers;
+    DWORD count = 0;
+    for (; index < segments.size() && count < buffers.size(); ++index, offset = 0) {
+        auto segment = segments[index].subspan(offset);
+        if (segment.empty()) continue;
+        buffers[count].buf = reinterpret_cast<CHAR*>(const_cast<uint8_t*>(segment.data()));
+        buffers[count].len = static_cast<ULONG>(segment.size());
+        ++count;
+    }
+
+    if (count == 0) {
+        return size_t(0);
+    }
+
+    DWORD sent = 0;
+    if (WSASend(sock_, buffers.data(), count, &sent, 0, nullptr, nullptr) == SOCKET_ERROR) {
+        return std::unexpected(getLastError(SocketError::Type::Send));
+    }
+
+    return static_cast<size_t>(sent);
+}
+
+SocketError WinsockSocket::sendv(Segments segments) {
+    if (!initialized_) {
+        return { SocketError::Type::Initialization, 0 };
+    }
+
+    size_t index = 0;
+    size_t offset = 0;
+    while (index < segments.size()) {
+        auto result = sendSegments(segments, index, offset);
+        if (!result.has_value()) {
+            if (result.error().type == SocketError::Type::WouldBlock) {
+                WSAPOLLFD pfd{};
+                pfd.fd = sock_;
+                pfd.events = POLLWRNORM;
+                if (WSAPoll(&pfd, 1, -1) == SOCKET_ERROR) {
+                    return getLastError(SocketError::Type::Send);
+                }
+                continue;
+            }
+            return result.error();
+        }
+
+        // Advance Past Whatever the Stack Took
+        size_t sent = result.value();
+        while (index < segments.size() && sent >= segments[index].size() - offset) {
+            sent -= segments[index].size() - offset;
+            offset = 0;
+            ++index;
+        }
+        offset += sent;
+    }
+
+    return SocketError::success();
+}
+
+std::expected<size_t, SocketError> WinsockSocket::sendvSome(Segments segments) {
+    if (!initialized_) {
+        return std::unexpected(SocketError{ SocketError::Type::Initialization, 0 });
+    }
+
+    return sendSegments(segments, 0, 0);
+}
+
 SocketError WinsockSocket::setNonBlocking() {
     if (!initialized_) return{ SocketError::Type::Initialization, 0 };;
 
@@ -169,21 +269,80 @@ SocketError WinsockSocket::setNonBlocking() {
     return SocketError::success();
 }
 
+SocketError WinsockSocket::setReusePort() {
+    // SO_REUSEADDR Here Lets a Second Listener Steal the Port Rather Than
+    // Share it; There is No Load-Balanced Equivalent
+    return { SocketError::Type::Initialization, WSAEOPNOTSUPP };
+}
+
+std::shared_ptr<Socket> WinsockSocket::createSibling() const {
+    return std::make_shared<WinsockSocket>(resource_);
+}
+
 std::expected<std::pmr::vector<uint8_t>, SocketError> WinsockSocket::receive(size_t maxSize) {
     if (!initialized_) {
         return std::unexpected(SocketError{ SocketError::Type::Initialization, 0 });
     }
 
     std::pmr::vector<uint8_t> buffer(maxSize, resource_);
+    auto bytesReceived = receiveInto(buffer);
+    if (!bytesReceived.has_value()) {
+        return std::unexpected(bytesReceived.error());
+    }
+
+    buffer.resize(bytesReceived.value());
+    return buffer;
+}
+
+std::expected<size_t, SocketError> WinsockSocket::receiveInto(std::span<uint8_t> buffer) {
+    if (!initialized_) {
+        return std::unexpected(SocketError{ SocketError::Type::Initialization, 0 });
+    }
+
     int bytesReceived = recv(sock_, reinterpret_cast<char*>(buffer.data()),
-        static_cast<int>(maxSize), 0);
+        static_cast<int>(buffer.size()), 0);
 
     if (bytesReceived == SOCKET_ERROR) {
         return std::unexpected(getLastError(SocketError::Type::Receive));
     }
 
-    buffer.resize(bytesReceived);
-    return buffer;
+    return static_cast<size_t>(bytesReceived);
+}
+
+std::expected<bool, SocketError> WinsockSocket::waitReadable(std::chrono::milliseconds timeout) {
+    if (!initialized_) {
+        return std::unexpected(SocketError{ SocketError::Type::Initialization, 0 });
+    }
+
+    WSAPOLLFD pfd{};
+    pfd.fd = sock_;
+    pfd.events = POLLRDNORM;
+
+    int result = WSAPoll(&pfd, 1, static_cast<INT>(timeout.count()));
+    if (result == SOCKET_ERROR) {
+        return std::unexpected(getLastError(SocketError::Type::Receive));
+    }
+
+    // Hang-Up/Error Count as Readable so the Caller Observes Them via receive()
+    return result > 0;
+}
+
+std::expected<bool, SocketError> WinsockSocket::waitWritable(std::chrono::milliseconds timeout) {
+    if (!initialized_) {
+        return std::unexpected(SocketError{ SocketError::Type::Initialization, 0 });
+    }
+
+    WSAPOLLFD pfd{};
+    pfd.fd = sock_;
+    pfd.events = POLLWRNORM;
+
+    int result = WSAPoll(&pfd, 1, static_cast<INT>(timeout.count()));
+    if (result == SOCKET_ERROR) {
+        return std::unexpected(getLastError(SocketError::Type::Send));
+    }
+
+    // Hang-Up/Error Count as Writable so the Caller Observes Them via send()
+    return result > 0;
 }
 
 void WinsockSocket::close() {
@@ -218,6 +377,10 @@ int WinsockSocket::setTimeout() {
     return 0;
 }
 
+intptr_t WinsockSocket::getNativeHandle() const {
+    return static_cast<intptr_t>(sock_);
+}
+
 bool WinsockSocket::isSameSocket(const std::shared_ptr<Socket>& other) const {
     if (auto* otherWinsock = dynamic_cast<const WinsockSocket*>(other.get())) {
         return sock_ == otherWinsock->sock_;
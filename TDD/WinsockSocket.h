@@ -1,6 +1,8 @@
 #pragma once
 
-#ifdef LIB_EXPORTS
+#if !defined(_WIN32)
+#define API
+#elif defined(LIB_EXPORTS)
 #define API __declspec(dllexport)
 #else
 #define API __declspec(dllimport)
@@ -31,18 +33,30 @@ public:
     SocketError connect(const std::pmr::string& address, uint16_t port);
 
     SocketError send(const std::pmr::vector<uint8_t>& data);
+    std::expected<size_t, SocketError> sendSome(std::span<const uint8_t> data) override;
+    SocketError sendv(Segments segments) override;
+    std::expected<size_t, SocketError> sendvSome(Segments segments) override;
 
     std::expected<std::pmr::vector<uint8_t>, SocketError> receive(size_t maxSize);
+    std::expected<size_t, SocketError> receiveInto(std::span<uint8_t> buffer) override;
+    std::expected<bool, SocketError> waitReadable(std::chrono::milliseconds timeout) override;
+    std::expected<bool, SocketError> waitWritable(std::chrono::milliseconds timeout) override;
 
     void close() override;
     int setTimeout() override;
-    SocketError setNonBlocking();
+    SocketError setNonBlocking() override;
+    SocketError setReusePort() override;
+    std::shared_ptr<Socket> createSibling() const override;
     bool isSameSocket(const std::shared_ptr<Socket>& other) const override;
+    intptr_t getNativeHandle() const override;
     std::pmr::memory_resource* getMemoryResource() const override;
 private:
     static SocketError getLastError(SocketError::Type type);
     static SocketError initWinsock();
 
+    // One WSASend() Starting offset Bytes Into segments[index]
+    std::expected<size_t, SocketError> sendSegments(Segments segments, size_t index, size_t offset);
+
     SOCKET sock_;
     bool initialized_;
     std::pmr::memory_resource* resource_;
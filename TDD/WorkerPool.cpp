@@ -0,0 +1,130 @@
+#include "WorkerPool.h"
+#include <algorithm>
+#include <iostream>
+
+WorkerPool::WorkerPool(size_t threadCount, std::pmr::memory_resource* resource)
+    : resource_(resource),
+    workers_(resource),
+    nextWorker_(0),
+    queued_(0),
+    sleepers_(0),
+    stopping_(false),
+    steals_(0)
+{
+    threadCount = std::max<size_t>(threadCount, 1);
+    workers_.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        workers_.push_back(make_pmr_unique_ptr<Worker>(resource_, resource_));
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    stop();
+}
+
+void WorkerPool::start() {
+    stopping_ = false;
+    for (size_t i = 0; i < workers_.size(); ++i) {
+        if (!workers_[i]->thread.joinable()) {
+            workers_[i]->thread = std::thread(&WorkerPool::run, this, i);
+        }
+    }
+}
+
+void WorkerPool::stop() {
+    if (stopping_.exchange(true)) return;
+
+    // Leaving Zero Wakes Every Sleeper; They See stopping_ and Exit
+    queued_.fetch_add(1);
+    queued_.notify_all();
+
+    for (auto& worker : workers_) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+
+    for (auto& worker : workers_) {
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        worker->tasks.clear();
+    }
+    queued_ = 0;
+}
+
+bool WorkerPool::submit(Task task) {
+    Worker& worker = *workers_[nextWorker_.fetch_add(1, std::memory_order_relaxed) % workers_.size()];
+    {
+        // Checked Under the Lock stop() Clears the Deque With, so Nothing Slips in After
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (stopping_) {
+            return false;
+        }
+        worker.tasks.push_back(std::move(task));
+    }
+
+    // Paired With the Sleeper's Increment-Then-Check: One of Us Sees the Other
+    queued_.fetch_add(1);
+    if (sleepers_.load() > 0) {
+        queued_.notify_one();
+    }
+    return true;
+}
+
+size_t WorkerPool::getThreadCount() const {
+    return workers_.size();
+}
+
+size_t WorkerPool::getStealCount() const {
+    return steals_.load(std::memory_order_relaxed);
+}
+
+void WorkerPool::run(size_t index) {
+    Task task;
+    while (!stopping_) {
+        if (take(index, task)) {
+            queued_.fetch_sub(1);
+            try {
+                task();
+            }
+            catch (const std::exception& e) {
+                std::cerr << "Worker task exception: " << e.what() << std::endl;
+            }
+            catch (...) {
+                std::cerr << "Unknown exception in worker task" << std::endl;
+            }
+            task = nullptr;
+            continue;
+        }
+
+        sleepers_.fetch_add(1);
+        if (queued_.load() == 0 && !stopping_) {
+            queued_.wait(0);
+        }
+        sleepers_.fetch_sub(1);
+    }
+}
+
+bool WorkerPool::take(size_t index, Task& task) {
+    {
+        Worker& own = *workers_[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.front());
+            own.tasks.pop_front();
+            return true;
+        }
+    }
+
+    // Steal the Newest Task Elsewhere; the Owner Keeps Working From the Oldest
+    for (size_t offset = 1; offset < workers_.size(); ++offset) {
+        Worker& victim = *workers_[(index + offset) % workers_.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.back());
+            victim.tasks.pop_back();
+            steals_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
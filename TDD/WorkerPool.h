@@ -0,0 +1,76 @@
+#pragma once
+
+#if !defined(_WIN32)
+#define API
+#elif defined(LIB_EXPORTS)
+#define API __declspec(dllexport)
+#else
+#define API __declspec(dllimport)
+#endif
+
+#include "PMRDeleter.h"
+#include <memory>
+#include <memory_resource>
+#include <functional>
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+
+// Fixed Set of Threads Running Submitted Tasks
+//
+// Every Worker Owns a Deque. submit() Deals Tasks Round-Robin Over Them; a
+// Worker Takes From the Front of its Own and, Once That is Empty, Steals
+// From the Back of the Others', so a Task Stuck Behind a Slow One Moves to
+// Whichever Worker Frees Up First. Idle Workers Sleep on the Count of
+// Queued Tasks and Cost Nothing Until There is Work.
+class API WorkerPool {
+public:
+    using Task = std::function<void()>;
+
+    WorkerPool(size_t threadCount, std::pmr::memory_resource* resource);
+    ~WorkerPool();
+
+    void start();
+    // Joins Every Worker; Running Tasks Finish, Tasks Not Yet Started are Dropped
+    void stop();
+
+    // Thread-Safe; False Once stop() Has Begun, and the Task Never Runs
+    bool submit(Task task);
+
+    size_t getThreadCount() const;
+    // Tasks Run by a Worker Other Than the One They Were Dealt to
+    size_t getStealCount() const;
+
+    // Deleted Copy/Move Ops
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+    WorkerPool(WorkerPool&&) = delete;
+    WorkerPool& operator=(WorkerPool&&) = delete;
+
+private:
+    // Own Line Each, so Neighbouring Workers' Locks Do Not Share a Cache Line
+    struct alignas(64) Worker {
+        std::mutex mutex;
+        std::pmr::deque<Task> tasks;
+        std::thread thread;
+
+        explicit Worker(std::pmr::memory_resource* resource) : tasks(resource) {}
+    };
+    using WorkerPtr = std::unique_ptr<Worker, PMRDeleter<Worker>>;
+
+    void run(size_t index);
+    // Own Deque First, Then the Others'; False if Every Deque Was Empty
+    bool take(size_t index, Task& task);
+
+    std::pmr::memory_resource* resource_;
+    std::pmr::vector<WorkerPtr> workers_;
+    std::atomic<size_t> nextWorker_;
+
+    // Queued, Not Yet Taken; Sleepers Wait for it to Leave Zero
+    std::atomic<size_t> queued_;
+    std::atomic<size_t> sleepers_;
+    std::atomic<bool> stopping_;
+    std::atomic<size_t> steals_;
+};